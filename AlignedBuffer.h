@@ -0,0 +1,77 @@
+/* Class AlignedBuffer is a minimal fixed-size array whose storage
+ * starts on an ALIGNED_BUFFER_ALIGNMENT-byte boundary, so the
+ * structure-of-arrays sample blocks handed to batch models can be
+ * loaded with aligned vector instructions.
+ */
+
+#ifndef ALIGNEDBUFFER_H
+#define ALIGNEDBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#define ALIGNED_BUFFER_ALIGNMENT 64  /* cache line, AVX-512 register */
+
+template <typename T>
+class AlignedBuffer
+{
+ private:
+  char *raw;  /* block returned by new[], includes alignment slack */
+  T *data_;  /* aligned start of the elements */
+  size_t size_;  /* number of elements */
+
+ public:
+  AlignedBuffer() : raw(NULL), data_(NULL), size_(0) {}
+  explicit AlignedBuffer(size_t n) : raw(NULL), data_(NULL), size_(0)
+    {
+      resize(n);
+    }
+  AlignedBuffer(const AlignedBuffer &other)
+    : raw(NULL), data_(NULL), size_(0)
+    {
+      resize(other.size_);
+      if (size_)
+	memcpy(data_, other.data_, size_*sizeof(T));
+    }
+  AlignedBuffer& operator=(const AlignedBuffer &other)
+    {
+      if (this != &other)
+	{
+	  resize(other.size_);
+	  if (size_)
+	    memcpy(data_, other.data_, size_*sizeof(T));
+	}
+      return *this;
+    }
+  ~AlignedBuffer()
+    {
+      delete [] raw;
+    }
+
+  /* reallocates to n zeroed elements; contents are not preserved */
+  void resize(size_t n)
+  {
+    if (n == size_)
+      return;
+    delete [] raw;
+    raw = NULL;
+    data_ = NULL;
+    size_ = n;
+    if (n == 0)
+      return;
+    raw = new char[n*sizeof(T) + ALIGNED_BUFFER_ALIGNMENT];
+    uintptr_t p = reinterpret_cast<uintptr_t>(raw);
+    p = (p + ALIGNED_BUFFER_ALIGNMENT - 1)
+      & ~(uintptr_t)(ALIGNED_BUFFER_ALIGNMENT - 1);
+    data_ = reinterpret_cast<T*>(p);
+    memset(data_, 0, n*sizeof(T));
+  }
+
+  size_t size() const {return size_;}
+  T* data() {return data_;}
+  const T* data() const {return data_;}
+  T& operator[](size_t i) {return data_[i];}
+  const T& operator[](size_t i) const {return data_[i];}
+};
+#endif
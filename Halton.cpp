@@ -51,93 +51,301 @@
 #include "Halton.h"
 
 
-genRand_64* halton::pgR64 = genRand_64::Instance();
+halton_tables::halton_tables(uint16 d)
+{
+	dim = d;
+	base = new uint32[d];
+	width = new uint8[d];
+	pwr = new uint64*[d];
+	for(uint16 i = 0; i < d; i++)
+		pwr[i] = NULL;
+	ppm = NULL;
+}
 
-uint32 halton::base[HALTON_DIM];
-uint64 halton::pwr[HALTON_DIM][WIDTH];
-uint32** halton::ppm = NULL;
+halton_tables::~halton_tables()
+{
+	for(uint16 i = 0; i < dim; i++)
+	{
+		delete [] pwr[i];
+		if(ppm)
+			delete [] ppm[i];
+	}
+	delete [] pwr;
+	delete [] ppm;
+	delete [] width;
+	delete [] base;
+}
 
 halton::halton(bool isMaster)
 {
 	isRandomStart = false;
 	isRandomlyPermuted = false;
-	isPowerInitialized = false;
 	isMasterThread = isMaster;
 	dim = 0;
-	isPermutationReady = false;
+	bufferDim = 0;
+	start = NULL;
+	rnd = NULL;
+	digit = NULL;
+	base = NULL;
+	width = NULL;
+	pwr = NULL;
+	ppm = NULL;
+	pgR64 = genRand_64::Instance();
+	ownRNG = NULL;
+}
+
+void halton::set_tables(const std::shared_ptr<halton_tables> &t)
+{
+	tables = t;
+	base = t->base;
+	width = t->width;
+	pwr = t->pwr;
+	ppm = t->ppm;
 }
 
+//Draws the random start & permutation of init() from a generator of
+//this instance seeded with seed, so they do not depend on other
+//generators.  Call before init().
+void halton::set_seed(uint64 seed)
+{
+	delete ownRNG;
+	ownRNG = new genRand_64(seed);
+	pgR64 = ownRNG;
+}
+
+//Makes this generator follow master's sequence: same dim, tables,
+//start & flags, positioned as init() leaves it.  Use seek() to move.
+void halton::attach(const halton &master)
+{
+	assert(master.tables);
+	set_dim(master.dim);
+	set_tables(master.tables);
+	isRandomStart = master.isRandomStart;
+	isRandomlyPermuted = master.isRandomlyPermuted;
+	memcpy(start, master.start, dim * sizeof(uint64));
+	allocate_buffer();
+	clear_buffer();
+	init_expansion();
+}
+
+//Computes the digits kept per coordinate, as many as UINT64_MAX has
+//in base[d], & the powers of the bases up to them.
 void halton::set_power_buffer()
 {
 	for(uint16 d = 0; d < dim; d++)
-		for(uint8 j = 0; j < WIDTH; j++)
+	{
+		uint64 n = ~0ULL;
+		width[d] = 0;
+		while(n > 0)
+		{
+			n /= base[d];
+			width[d]++;
+		}
+		delete [] pwr[d];
+		pwr[d] = new uint64[width[d]];
+		for(uint8 j = 0; j < width[d]; j++)
 		{
 			if(j == 0) 
 				pwr[d][j] = base[d];
 			else
 				pwr[d][j] = pwr[d][j - 1] * base[d];
 		}
-	isPowerInitialized = true;
+	}
+}
+
+//Sizes rnd & digit for dim coordinates of the current bases: 64
+//digits for base 2 but 6 for base 2741 (dim 400), so the state is a
+//few KB instead of HALTON_DIM x WIDTH rows.
+void halton::allocate_buffer()
+{
+	if(bufferDim == dim && rnd)
+		return;
+	free_buffer();
+
+	uint32 rndSize = 0, digitSize = 0;
+	for(uint16 i = 0; i < dim; i++)
+	{
+		rndSize += width[i] + 1;
+		digitSize += width[i];
+	}
+
+	rnd = new real*[dim];
+	digit = new uint32*[dim];
+	rnd[0] = new real[rndSize];
+	digit[0] = new uint32[digitSize];
+	for(uint16 i = 1; i < dim; i++)
+	{
+		rnd[i] = rnd[i - 1] + width[i - 1] + 1;
+		digit[i] = digit[i - 1] + width[i - 1];
+	}
+	bufferDim = dim;
+}
+
+void halton::free_buffer()
+{
+	if(rnd)
+	{
+		delete [] rnd[0];
+		delete [] digit[0];
+	}
+	delete [] rnd;
+	delete [] digit;
+	rnd = NULL;
+	digit = NULL;
+	bufferDim = 0;
 }
 
 void halton::clear_buffer()
 {
-	memset(digit, 0, sizeof(digit));
-	memset(rnd, 0, sizeof(rnd));
+	for(uint16 i = 0; i < dim; i++)
+	{
+		memset(digit[i], 0, width[i] * sizeof(uint32));
+		memset(rnd[i], 0, (width[i] + 1) * sizeof(real));
+	}
+}
+
+//Bytes of per-instance state on the heap (start, rnd, digit & row
+//pointers); sizeof(halton) adds the rest, the shared tables excluded.
+uint64 halton::get_buffer_bytes()
+{
+	uint64 bytes = 0;
+	for(uint16 i = 0; i < bufferDim; i++)
+		bytes += (width[i] + 1) * sizeof(real) + width[i] * sizeof(uint32);
+	return bytes + dim * sizeof(uint64)
+		+ bufferDim * (sizeof(real*) + sizeof(uint32*));
 }
 
 void halton::init_expansion()
 {
-	uint16 i;
-	int8 j;
-	uint64 n = 0;
+	for(uint16 i = 0; i < dim; i++)
+		expand(i, start[i] - 1);
+}
+
+//Sets the digits & partial sums of coordinate i to the expansion of n,
+//so that rnd[i][0] is the n-th point and genHalton() moves to n + 1.
+//Costs O(log n) plus clearing the row.
+void halton::expand(uint16 i, uint64 n)
+{
+	int8 j = 0;
 	uint32 d = 0;
-	for(i = 0; i < dim; i++)
+	memset(digit[i], 0, width[i] * sizeof(uint32));
+	memset(rnd[i], 0, (width[i] + 1) * sizeof(real));
+	while(n > 0)
 	{
-		n = start[i] - 1;
-		j = 0;
-		while(n > 0)
-		{
-			digit[i][j] = n % base[i];
-			n = n / base[i];
-			j++;
-		}
+		digit[i][j] = n % base[i];
+		n = n / base[i];
+		j++;
+	}
+	j--;
+	while(j >= 0)
+	{
+		d = digit[i][j];
+		if(isRandomlyPermuted)
+			d = permute(i, j);
+		rnd[i][j] = rnd[i][j + 1] + d * 1.0 / pwr[i][j];
 		j--;
-		while(j >= 0)
-		{
-			d = digit[i][j];
-			if(isRandomlyPermuted)
-				d = permute(i, j);
-			rnd[i][j] = rnd[i][j + 1] + d * 1.0 / pwr[i][j];
-			j--;
-		}
 	}
 }
 
+//Positions the sequence so that the next genHalton() gives point
+//start + n, i.e. point n counted from the (random) start; seek(0) is
+//where init() leaves the sequence.  O(dim log n), start[] unchanged.
+void halton::seek(uint64 n)
+{
+	allocate_buffer();
+	for(uint16 i = 0; i < dim; i++)
+		expand(i, start[i] + n - 1);
+}
+
+//Makes point n counted from the start current, as seek(n) followed by
+//genHalton() would; iteration continues from it with genHalton().
+void halton::genHaltonAt(uint64 n)
+{
+	allocate_buffer();
+	for(uint16 i = 0; i < dim; i++)
+		expand(i, start[i] + n);
+}
+
 void halton::genHalton()
 {
-	uint16 i;
+	for(uint16 i = 0; i < dim; i++)
+		step(i);
+}
+
+//Moves coordinate i to the next point: increments the digits with
+//carry and updates the partial sums of the digits that changed.
+void halton::step(uint16 i)
+{
 	int8 j;
-	uint64 n = 0;
 	uint32 d = 0;
 
-	for(i = 0; i < dim; i++)
+	j = 0;
+	while(digit[i][j] + 1 >= base[i])
+		j++;
+	digit[i][j]++;
+	d = digit[i][j];
+	if(isRandomlyPermuted)
+		d = permute(i, j);
+	rnd[i][j] = rnd[i][j + 1] + d * 1.0 / pwr[i][j];
+	for(j = j - 1; j >= 0; j--)
 	{
-		j = 0;
-		while(digit[i][j] + 1 >= base[i])
-			j++;
-		digit[i][j]++;
-		d = digit[i][j];
+		digit[i][j] = 0;
+		d = 0;
 		if(isRandomlyPermuted)
 			d = permute(i, j);
 		rnd[i][j] = rnd[i][j + 1] + d * 1.0 / pwr[i][j];
-		for(j = j - 1; j >= 0; j--)
+	}
+}
+
+//Generates the next B points, as B calls of genHalton() would, and
+//writes them structure-of-arrays: coordinate d of point b goes to
+//out[(d - 1) * stride + b].
+void halton::genHaltonBlock(uint32 B, real *out, uint32 stride)
+{
+	genHaltonBlock(1, dim, B, out, stride);
+}
+
+//As above for coordinates d0..d0 + count - 1 only, coordinate d going
+//to out[(d - d0) * stride + b], e.g. to fill the x1 & x2 blocks of a
+//sample with two calls.  The other coordinates do not move, so every
+//coordinate must be advanced by the same B before genHalton() or
+//get_rnd() are used again.
+//
+//Between carries only the lowest digit of a coordinate changes, so
+//its points are rnd[i][1] plus the contribution of the lowest digit;
+//those runs (up to base - 1 points) are written in a tight loop and
+//only the carries take the digit-by-digit path of genHalton().  The
+//values are bitwise those of genHalton().
+void halton::genHaltonBlock(uint16 d0, uint16 count, uint32 B,
+			    real *out, uint32 stride)
+{
+	for(uint16 i = d0 - 1; i < d0 - 1 + count; i++)
+	{
+		real *col = out + (i - d0 + 1) * stride;
+		uint32 b = 0;
+		while(b < B)
 		{
-			digit[i][j] = 0;
-			d = 0;
-			if(isRandomlyPermuted)
-				d = permute(i, j);
-			rnd[i][j] = rnd[i][j + 1] + d * 1.0 / pwr[i][j];
+			if(digit[i][0] + 1 >= base[i])
+			{
+				step(i);
+				col[b++] = rnd[i][0];
+				continue;
+			}
+
+			uint32 run = base[i] - 1 - digit[i][0];
+			if(run > B - b)
+				run = B - b;
+			real high = rnd[i][1];
+			uint32 first = digit[i][0] + 1;
+			const uint32 *perm = isRandomlyPermuted ? ppm[i] : NULL;
+			for(uint32 k = 0; k < run; k++)
+			{
+				uint32 d = perm ? perm[first + k] : first + k;
+				col[b + k] = high + d * 1.0 / pwr[i][0];
+			}
+			b += run;
+			digit[i][0] += run;
+			rnd[i][0] = col[b - 1];
 		}
 	}
 }
@@ -157,9 +365,9 @@ void halton::set_permutation()
 			*(ppm + i) = NULL;
 		}
 		delete [] ppm;
-		ppm = NULL;
+		ppm = tables->ppm = NULL;
 	}
-	ppm = new uint32* [dim];
+	ppm = tables->ppm = new uint32* [dim];
 	
 	uint32 j, k, tmp;
 	
@@ -180,7 +388,6 @@ void halton::set_permutation()
 			}
 		}
 	}
-	isPermutationReady = true;
 }
 
 void halton::get_prime(uint16 n, uint32 *p)
@@ -205,6 +412,12 @@ void halton::get_prime(uint16 n, uint32 *p)
 void halton::set_dim(uint16 d)
 {
 	assert(d <= HALTON_DIM);
+	if(d != dim || !start)
+	{
+		delete [] start;
+		start = new uint64[d];
+		memset(start, 0, d * sizeof(uint64));
+	}
 	dim = d;
 }
 
@@ -254,11 +467,17 @@ uint64 halton::rnd_start(double r, uint32 base)
 	return z;
 }
 
+//A master builds new tables, so generators attached to it before keep
+//the old ones; a worker must have been attach()ed.
 void halton::init(uint16 dim, bool rs, bool rp)
 {
 	set_dim(dim);
 	if(isMasterThread)
+	{
+		set_tables(std::make_shared<halton_tables>(dim));
 		set_base();
+		set_power_buffer();
+	}
 	set_random_start_flag(rs);
 	set_permute_flag(rp);
 	configure();
@@ -266,12 +485,18 @@ void halton::init(uint16 dim, bool rs, bool rp)
 
 void halton::configure()
 {
+	assert(tables && tables->dim == dim);
+	allocate_buffer();
 	if(isMasterThread)
+	{
+		std::unique_lock<std::mutex> lock(genRand_64::InstanceMutex(),
+						  std::defer_lock);
+		if(!ownRNG)
+			lock.lock();
 		set_start();
-	if(isMasterThread && !isPowerInitialized)
-		set_power_buffer();
+		if(isRandomlyPermuted)
+			set_permutation();
+	}
 	clear_buffer();
-	if(isMasterThread && isRandomlyPermuted && !isPermutationReady)
-		set_permutation();
 	init_expansion();
 }
\ No newline at end of file
@@ -48,6 +48,7 @@
 #ifndef _HALTON_H
 #define _HALTON_H
 
+#include <memory>
 #include "MT64.h"
 
 
@@ -63,44 +64,70 @@ typedef int int16;
 typedef long int32;
 typedef long long int64;
 
-#define HALTON_DIM 1000		//Maximum dimension allowed. Match minimum need to save memory.
-							//Support up to 4096 dimensions if memory size permits
+#define HALTON_DIM 1000		//Maximum dimension allowed.  All storage is sized by
+							//the dim of the instance, see allocate_buffer().
 #define WIDTH 64			//Maximum integer width
 
+//Bases, powers & digit permutations of one sequence.  A master's init()
+//builds them and nothing changes them after, so the master and any
+//number of generators attached to it read them concurrently.
+struct halton_tables
+{
+	halton_tables(uint16 d);
+	~halton_tables();
+
+	uint16 dim;
+	uint32 *base;		//first dim primes
+	uint8 *width;		//digits kept per coordinate, those of UINT64_MAX
+	uint64 **pwr;		//pwr[i][j] = base[i]^(j + 1), width[i] entries
+	uint32 **ppm;		//ppm[i] permutes 0..base[i] - 1; NULL if unpermuted
+
+private:
+	halton_tables(const halton_tables&);
+	halton_tables& operator=(const halton_tables&);
+};
+
+//A master (the default) draws its own random start & permutation in
+//init(), from the process-wide genRand_64 (serialized, so masters may
+//be initialized concurrently) or from its own generator if set_seed()
+//was called.  A worker, halton(false), is attach()ed to a master and
+//shares its tables & start; it keeps only its own digits, so it can
+//walk another part of the same sequence in another thread.
 class halton
 {
 public:
 	halton(bool isMaster = true);
 	~halton()
 	{
-		if(isMasterThread && isRandomlyPermuted)
-		{
-			if(ppm)
-			{
-				for(uint16 i = 0; i < dim; i++)
-					delete [] *(ppm + i);
-				delete [] ppm;
-				ppm = NULL;
-			}
-		}
+		free_buffer();
+		delete [] start;
+		delete ownRNG;
 	}
 	void init(uint16 dim, bool rs, bool rp);
-	void configure();
+	void attach(const halton &master);
+	void set_seed(uint64 seed);
 	void init_expansion();
 	void set_dim(uint16 d);
-	void set_base();
 	void set_start();
 	void alter_start(uint32 d, uint64 rs);
-	void set_permutation();
 	void set_permute_flag(bool rp){isRandomlyPermuted = rp;}
 	void set_random_start_flag(bool rs){isRandomStart = rs;}
-	void set_power_buffer();
+	void allocate_buffer();
+	void free_buffer();
 	void clear_buffer();
+	uint64 get_buffer_bytes();
 	void print_permutation();
 	void print_rnd(uint16 d);
 	uint64 rnd_start(real r, uint32 base);
+	void expand(uint16 i, uint64 n);
+	void step(uint16 i);
 	
 	void genHalton();
+	void genHaltonBlock(uint32 B, real *out, uint32 stride);
+	void genHaltonBlock(uint16 d0, uint16 count, uint32 B, real *out,
+			    uint32 stride);
+	void seek(uint64 n);
+	void genHaltonAt(uint64 n);
 	
 	inline uint32 permute(uint8 i, uint8 j);
 	uint64 get_start(uint32 d){return start[d - 1];}
@@ -109,18 +136,35 @@ public:
 	
 private:
 	uint16 dim;
-	uint64 start[HALTON_DIM];
-	static uint32 base[HALTON_DIM];
-	real rnd[HALTON_DIM][WIDTH];
-	uint32 digit[HALTON_DIM][WIDTH];
-	static uint64 pwr[HALTON_DIM][WIDTH];
-	static uint32 **ppm;
-	static genRand_64 *pgR64;//Pseudorandom number generator handler
+	uint64 *start;			//dim entries, see set_dim()
+	uint16 bufferDim;		//dim rnd & digit were allocated for
+	//Row i of rnd & digit holds coordinate i, width[i] digits plus a
+	//zero guard for rnd[i][j + 1].  The rows are packed back to back
+	//in one block per array.
+	real **rnd;
+	uint32 **digit;
+	//Shared read-only tables & shortcuts to their arrays
+	std::shared_ptr<halton_tables> tables;
+	uint32 *base;
+	uint8 *width;
+	uint64 **pwr;
+	uint32 **ppm;
+	genRand_64 *pgR64;//Pseudorandom number generator handler
+	genRand_64 *ownRNG;//pgR64 if set_seed() was called, else NULL
 	bool isRandomlyPermuted;
 	bool isRandomStart;
-	bool isPowerInitialized;
 	bool isMasterThread;
-	bool isPermutationReady;
+
+	void set_tables(const std::shared_ptr<halton_tables> &t);
+	//For init() only: on a master they fill the tables it has just
+	//made, which attached workers then share read-only
+	void configure();
+	void set_base();
+	void set_permutation();
+	void set_power_buffer();
+
+	halton(const halton&);
+	halton& operator=(const halton&);
 };
 
 #endif
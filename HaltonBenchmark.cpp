@@ -0,0 +1,98 @@
+/* Times halton::genHaltonBlock against the point-at-a-time
+ * genHalton() + get_rnd() loop that fills the same structure-of-arrays
+ * block, for a few dimensions, checks that both give the same numbers
+ * and prints the memory of a generator; then times the scrambled
+ * Sobol' block generator on the same block.  Usage: ./a.out [N]
+ * [blockSize]
+ */
+
+#include "Halton.h"
+#include "SobolSequence.h"
+#include "AlignedBuffer.h"
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+/* Generates N points in blocks of B with gen(h, B, block), returns the
+ * time per point in ns */
+template <class Generator, class F>
+double Time(Generator &h, unsigned int N, unsigned int B,
+	    AlignedBuffer<real> &block, F gen)
+{
+  clock_t tic = clock();
+  for (unsigned int i = 0; i < N; i += B)
+    {
+      gen(h, std::min(B, N - i), block);
+    }
+  double toc = (double)(clock() - tic) / CLOCKS_PER_SEC;
+  return 1e9*toc/N;
+}
+
+int main(int argc, char** argv)
+{
+  unsigned int N = argc > 1 ? atoi(argv[1]) : 1000000;
+  unsigned int B = argc > 2 ? atoi(argv[2]) : 256;
+  const unsigned int dims[] = {4, 40, 400};
+
+  std::cout << "N = " << N << ", block size " << B << "\n";
+  for (unsigned int d = 0; d < sizeof(dims)/sizeof(dims[0]); ++d)
+    {
+      unsigned int dim = dims[d];
+      AlignedBuffer<real> block(dim*B), check(dim*B);
+
+      /* a worker of the master, on the same starts & permutation */
+      halton pointwise, blockwise(false);
+      pointwise.init(dim, true, true);
+      blockwise.attach(pointwise);
+
+      double tPoint = Time(pointwise, N, B, block,
+			   [dim](halton &h, unsigned int n,
+				 AlignedBuffer<real> &x)
+			   {
+			     for (unsigned int b = 0; b < n; ++b)
+			       {
+				 h.genHalton();
+				 for (unsigned int j = 0; j < dim; ++j)
+				   {
+				     x[j*n + b] = h.get_rnd(j+1);
+				   }
+			       }
+			   });
+      double tBlock = Time(blockwise, N, B, block,
+			   [](halton &h, unsigned int n,
+			      AlignedBuffer<real> &x)
+			   {
+			     h.genHaltonBlock(n, x.data(), n);
+			   });
+
+      /* one more block from each must match */
+      for (unsigned int b = 0; b < B; ++b)
+	{
+	  pointwise.genHalton();
+	  for (unsigned int j = 0; j < dim; ++j)
+	    {
+	      check[j*B + b] = pointwise.get_rnd(j+1);
+	    }
+	}
+      blockwise.genHaltonBlock(B, block.data(), B);
+      bool same = !memcmp(block.data(), check.data(), dim*B*sizeof(real));
+
+      std::cout << "dim " << dim << ": genHalton+get_rnd " << tPoint
+		<< " ns/point, genHaltonBlock " << tBlock << " ns/point ("
+		<< tPoint/tBlock << "x), "
+		<< (same ? "same points" : "POINTS DIFFER") << ", "
+		<< sizeof(halton) + pointwise.get_buffer_bytes()
+		<< " bytes/generator\n";
+
+      sobol_sequence sobol;
+      sobol.init(dim, true);
+      double tSobol = Time(sobol, N, B, block,
+			   [](sobol_sequence &s, unsigned int n,
+			      AlignedBuffer<real> &x)
+			   {
+			     s.genSobolBlock(n, x.data(), n);
+			   });
+      std::cout << "        genSobolBlock " << tSobol << " ns/point\n";
+    }
+}
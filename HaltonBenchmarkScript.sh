@@ -0,0 +1,5 @@
+#!/bin/bash
+
+g++ -O3 -std=c++0x -pthread HaltonBenchmark.cpp Halton.cpp SobolSequence.cpp SobolDirections.cpp MT64.cpp
+
+# ./a.out 1000000 256
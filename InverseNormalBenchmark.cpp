@@ -0,0 +1,165 @@
+/* Accuracy & throughput of the inverse normal CDF approximations of
+ * class InverseTransformation.  The errors are measured against the
+ * AS241 value refined by a Newton step on erfc in long double, over
+ * the centre (|u - 1/2| <= 0.425) & three bands of the tails, with u
+ * log-uniform in the tails (the fast method stops at FLT_MIN); the
+ * times are per number of a block in cache, by the scalar
+ * StandardNormal() & by the batch Normal().  A NaN result is reported
+ * and makes the exit status 1.
+ * Usage: ./a.out [points per region] [repeats]
+ */
+
+#include "InverseTransformation.h"
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iomanip>
+
+/* quantile of u to about 1e-19 relative */
+Type ReferenceNormal(Type u)
+{
+  long double x = InverseTransformation::StandardNormal(INVERSE_NORMAL_AS241,
+							u);
+  const long double sqrt2 = 1.41421356237309504880L;
+  const long double sqrt2pi = 2.50662827463100050242L;
+  long double density = expl(-x*x/2)/sqrt2pi;
+  /* Newton on the smaller tail, so that u near 1 keeps its digits */
+  if (u < 0.5)
+    x -= (erfcl(-x/sqrt2)/2 - u)/density;
+  else
+    x += (erfcl(x/sqrt2)/2 - (1 - (long double)u))/density;
+  return x;
+}
+
+/* Max abs. & rel. errors of method over n points of a region, u = lo +
+ * (hi - lo)*k/n in the centre, or p = 10^(lo + (hi-lo)*k/n) in the
+ * tails, alternately u = p & u = 1 - p.  The upper tail is checked by
+ * symmetry against -x(1 - u), 1 - u being exact; where 1 - p rounds to
+ * 1 (p < 2^-53) the point is taken in the lower tail only.  Results
+ * that are NaN are counted in nanCount, not in the errors. */
+void Errors(InverseNormalMethod method, bool tail, Type lo, Type hi,
+	    unsigned int n, Type &absError, Type &relError,
+	    unsigned int &nanCount)
+{
+  std::vector<Type> u(n), x(n), ref(n);
+  for (unsigned int k = 0; k < n; ++k)
+    {
+      Type t = lo + (hi - lo)*(k + 0.5)/n;
+      if (!tail)
+	{
+	  u[k] = t;
+	  ref[k] = ReferenceNormal(u[k]);
+	}
+      else if (k % 2 && 1 - pow(10.0, t) < 1)
+	{
+	  u[k] = 1 - pow(10.0, t);
+	  ref[k] = -ReferenceNormal(1 - u[k]);
+	}
+      else
+	{
+	  u[k] = pow(10.0, t);
+	  ref[k] = ReferenceNormal(u[k]);
+	}
+    }
+
+  InverseTransformation invTrans(method);
+  invTrans.Normal(u.data(), n, 0, 1, x.data());
+
+  absError = relError = 0;
+  for (unsigned int k = 0; k < n; ++k)
+    {
+      /* also the scalar path, which may round differently */
+      Type xs = invTrans.StandardNormal(u[k]);
+      if (std::isnan(x[k]) || std::isnan(xs))
+	{
+	  ++nanCount;
+	  continue;
+	}
+      Type e = std::max(std::abs(x[k] - ref[k]), std::abs(xs - ref[k]));
+      absError = std::max(absError, e);
+      if (ref[k] != 0)
+	relError = std::max(relError, e/std::abs(ref[k]));
+    }
+}
+
+int main(int argc, char** argv)
+{
+  unsigned int n = argc > 1 ? atoi(argv[1]) : 100000;
+  int repeats = argc > 2 ? atoi(argv[2]) : 2000;
+
+  const char *methodNames[] = {"BSM", "AS241", "fast"};
+  const InverseNormalMethod methods[] = {INVERSE_NORMAL_BSM,
+					 INVERSE_NORMAL_AS241,
+					 INVERSE_NORMAL_FAST};
+
+  bool failed = false;
+  std::cout << std::setprecision(2) << std::scientific;
+  std::cout << "max abs. / rel. error, " << n << " points per region\n";
+  std::cout << "p = min(u, 1-u)\n";
+  std::cout << "method   0.075<u<0.925        1e-10<p<0.075        "
+	    << "1e-38<p<1e-10        1e-300<p<1e-38\n";
+  for (int m = 0; m < 3; ++m)
+    {
+      Type a, r;
+      unsigned int nans = 0;
+      std::cout << std::setw(6) << std::left << methodNames[m];
+      Errors(methods[m], false, 0.075, 0.925, n, a, r, nans);
+      std::cout << "   " << a << " / " << r;
+      Errors(methods[m], true, -10, log10(0.075), n, a, r, nans);
+      std::cout << "   " << a << " / " << r;
+      Errors(methods[m], true, -38, -10, n, a, r, nans);
+      std::cout << "   " << a << " / " << r;
+      Errors(methods[m], true, -300, -38, n, a, r, nans);
+      std::cout << "   " << a << " / " << r << "\n";
+      if (nans > 0)
+	{
+	  std::cout << methodNames[m] << ": " << nans << " NaN results\n";
+	  failed = true;
+	}
+    }
+
+  /* a block of uniforms in cache, as the samplers hand them over */
+  const unsigned int B = 512;
+  std::vector<Type> u(B), x(B);
+  for (unsigned int k = 0; k < B; ++k)
+    {
+      u[k] = (k*0.6180339887498949 - (int)(k*0.6180339887498949))
+	+ 0.5/B;
+      if (u[k] >= 1)
+	u[k] -= 1;
+    }
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "\nns/number, blocks of " << B << "\n";
+  std::cout << "method   scalar   batch\n";
+  for (int m = 0; m < 3; ++m)
+    {
+      InverseTransformation invTrans(methods[m]);
+      Type sum = 0;
+
+      clock_t tic = clock();
+      for (int r = 0; r < repeats; ++r)
+	{
+	  for (unsigned int k = 0; k < B; ++k)
+	    {
+	      x[k] = invTrans.StandardNormal(u[k]);
+	    }
+	  sum += x[r % B];
+	}
+      Type scalar = (Type)(clock() - tic) / CLOCKS_PER_SEC;
+
+      tic = clock();
+      for (int r = 0; r < repeats; ++r)
+	{
+	  invTrans.Normal(u.data(), B, 0, 1, x.data());
+	  sum += x[r % B];
+	}
+      Type batch = (Type)(clock() - tic) / CLOCKS_PER_SEC;
+
+      std::cout << std::setw(6) << std::left << methodNames[m]
+		<< std::right << std::setw(9) << 1e9*scalar/((Type)B*repeats)
+		<< std::setw(8) << 1e9*batch/((Type)B*repeats)
+		<< (sum == 12345 ? " " : "") << "\n";
+    }
+  return failed ? 1 : 0;
+}
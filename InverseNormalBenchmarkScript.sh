@@ -0,0 +1,5 @@
+#!/bin/bash
+
+g++ -O3 -std=c++0x InverseNormalBenchmark.cpp InverseTransformation.cpp MersenneTwister.cpp
+
+# ./a.out 100000 2000
@@ -1,7 +1,15 @@
+#include <cstring>
 #include "InverseTransformation.h"
 
-/* Dflt ctor */
-InverseTransformation::InverseTransformation() : MT() {}
+/* Ctor
+ * Input:
+ *
+ * method_ = inverse normal CDF approximation used by Normal(),
+ *   defaulted to Beasley-Springer-Moro in header
+ */
+InverseTransformation::
+InverseTransformation(InverseNormalMethod method_)
+  : MT(), method(method_) {}
 
 /* Returns a sample from the Generalized Pareto distribution.  This
  * function is different from the others in that the pseudorandom
@@ -66,6 +74,157 @@ Type InverseTransformation::GenPareto(Type k, Type sigma, Type theta)
  * variance = variance of normal distro
  */
 Type InverseTransformation::Normal(Type u, Type mean, Type variance)
+{
+  return mean + sqrt(variance)*StandardNormal(u);
+}
+
+/* Standard normal quantile of u by the approximation selected */
+Type InverseTransformation::StandardNormal(Type u) const
+{
+  return StandardNormal(method, u);
+}
+
+/* Wichura's AS241 coefficients: PPND16 (double) for |u - 1/2| <= 0.425
+ * (a/b), 0.425 < |u - 1/2| with r = sqrt(-log(min(u,1-u))) <= 5 (c/d)
+ * & r > 5 (e/f), and the same regions of PPND7 (single) */
+static const Type as241A[8] =
+  {3.3871328727963666080e0, 1.3314166789178437745e+2,
+   1.9715909503065514427e+3, 1.3731693765509461125e+4,
+   4.5921953931549871457e+4, 6.7265770927008700853e+4,
+   3.3430575583588128105e+4, 2.5090809287301226727e+3};
+static const Type as241B[8] =
+  {1.0, 4.2313330701600911252e+1, 6.8718700749205790830e+2,
+   5.3941960214247511077e+3, 2.1213794301586595867e+4,
+   3.9307895800092710610e+4, 2.8729085735721942674e+4,
+   5.2264952788528545610e+3};
+static const Type as241C[8] =
+  {1.42343711074968357734e0, 4.63033784615654529590e0,
+   5.76949722146069140550e0, 3.64784832476320460504e0,
+   1.27045825245236838258e0, 2.41780725177450611770e-1,
+   2.27238449892691845833e-2, 7.74545014278341407640e-4};
+static const Type as241D[8] =
+  {1.0, 2.05319162663775882187e0, 1.67638483018380384940e0,
+   6.89767334985100004550e-1, 1.48103976427480074590e-1,
+   1.51986665636164571966e-2, 5.47593808499534494600e-4,
+   1.05075007164441684324e-9};
+static const Type as241E[8] =
+  {6.65790464350110377720e0, 5.46378491116411436990e0,
+   1.78482653991729133580e0, 2.96560571828504891230e-1,
+   2.65321895265761230930e-2, 1.24266094738807843860e-3,
+   2.71155556874348757815e-5, 2.01033439929228813265e-7};
+static const Type as241F[8] =
+  {1.0, 5.99832206555887937690e-1, 1.36929880922735805310e-1,
+   1.48753612908506148525e-2, 7.86869131145613259100e-4,
+   1.84631831751005468180e-5, 1.42151175831644588870e-7,
+   2.04426310338993978564e-15};
+
+static const float ppnd7A[4] =
+  {3.3871327179e+00f, 5.0434271938e+01f, 1.5929113202e+02f,
+   5.9109374720e+01f};
+static const float ppnd7B[4] =
+  {1.0f, 1.7895169469e+01f, 7.8757757664e+01f, 6.7187563600e+01f};
+static const float ppnd7C[4] =
+  {1.4234372777e+00f, 2.7568153900e+00f, 1.3067284816e+00f,
+   1.7023821103e-01f};
+static const float ppnd7D[4] = {1.0f, 7.3700164250e-01f, 1.2021132975e-01f,
+				0.0f};
+static const float ppnd7E[4] =
+  {6.6579051150e+00f, 3.0812263860e+00f, 4.2868294337e-01f,
+   1.7337203997e-02f};
+static const float ppnd7F[4] = {1.0f, 2.4197894225e-01f, 1.2258202635e-02f,
+				0.0f};
+
+/* Polynomial() & the vector helpers below are inlined into the
+ * kernels built for each instruction set, so how vectors would be
+ * passed to them as calls (which -Wpsabi notes) does not matter. */
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+/* p[0] + p[1] r + ... + p[N-1] r^(N-1) by Horner's rule, for scalars &
+ * vectors alike */
+template <int N, class T, class C>
+static inline __attribute__ ((always_inline))
+T Polynomial(const C *p, const T &r)
+{
+  T s = r*p[N-1] + p[N-2];
+  for (int i = N - 3; i >= 0; --i)
+    {
+      s = s*r + p[i];
+    }
+  return s;
+}
+
+/* Wichura's AS241 PPND16: quantile of u to about 1e-16 relative */
+static Type StandardNormalAS241(Type u)
+{
+  Type q = u - 0.5;
+  if (std::abs(q) <= 0.425)
+    {
+      Type r = 0.180625 - q*q;
+      return q*Polynomial<8>(as241A, r)/Polynomial<8>(as241B, r);
+    }
+
+  Type r = sqrt(-log(q < 0 ? u : 1 - u));
+  Type x;
+  if (r <= 5)
+    {
+      r -= 1.6;
+      x = Polynomial<8>(as241C, r)/Polynomial<8>(as241D, r);
+    }
+  else
+    {
+      r -= 5;
+      x = Polynomial<8>(as241E, r)/Polynomial<8>(as241F, r);
+    }
+  return q < 0 ? -x : x;
+}
+
+/* Wichura's AS241 PPND7 in single precision: about 1e-7 relative.  The
+ * tail is cut at min(u, 1-u) = FLT_MIN, |x| = 13.2. */
+static Type StandardNormalFast(Type u)
+{
+  float q = u - 0.5;
+  if (std::abs(q) <= 0.425f)
+    {
+      float r = 0.180625f - q*q;
+      return q*Polynomial<4>(ppnd7A, r)/Polynomial<4>(ppnd7B, r);
+    }
+
+  float r = sqrtf(-logf(std::max(u < 0.5 ? u : 1 - u,
+				 1.17549435e-38)));
+  float x;
+  if (r <= 5)
+    {
+      r -= 1.6f;
+      x = Polynomial<4>(ppnd7C, r)/Polynomial<3>(ppnd7D, r);
+    }
+  else
+    {
+      r -= 5;
+      x = Polynomial<4>(ppnd7E, r)/Polynomial<3>(ppnd7F, r);
+    }
+  return q < 0 ? -x : x;
+}
+
+/* Standard normal quantile of u by the given approximation */
+Type InverseTransformation::StandardNormal(InverseNormalMethod method,
+					   Type u)
+{
+  switch (method)
+    {
+    case INVERSE_NORMAL_AS241:
+      return StandardNormalAS241(u);
+    case INVERSE_NORMAL_FAST:
+      return StandardNormalFast(u);
+    case INVERSE_NORMAL_BSM:
+    default:
+      return StandardNormalBSM(u);
+    }
+}
+
+/* Standard normal quantile of u by the Beasley-Springer-Moro
+ * approximation: rational in the centre, polynomial in log(-log) in
+ * the tails */
+Type InverseTransformation::StandardNormalBSM(Type u)
 {
   Type y = u - 0.5;
   Type x;  // return value
@@ -87,7 +246,361 @@ Type InverseTransformation::Normal(Type u, Type mean, Type variance)
       x = -x;
   }
 
-  return mean + sqrt(variance)*x;
+  return x;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+
+/* GCC vector types of 4, 8 & 16 doubles or floats and of as many
+ * integers of their size, for AVX2 & AVX-512 registers (pairs of
+ * registers for the 16 doubles) */
+typedef double v4df __attribute__ ((vector_size (32)));
+typedef long long v4di __attribute__ ((vector_size (32)));
+typedef double v8df __attribute__ ((vector_size (64)));
+typedef long long v8di __attribute__ ((vector_size (64)));
+typedef double v16df __attribute__ ((vector_size (128)));
+typedef long long v16di __attribute__ ((vector_size (128)));
+typedef float v8sf __attribute__ ((vector_size (32)));
+typedef int v8si __attribute__ ((vector_size (32)));
+typedef float v16sf __attribute__ ((vector_size (64)));
+typedef int v16si __attribute__ ((vector_size (64)));
+
+/* a where mask is set, b elsewhere */
+template <class V, class I>
+static inline __attribute__ ((always_inline))
+V Blend(const I &mask, const V &a, const V &b)
+{
+  return (V)(((I)a & mask) | ((I)b & ~mask));
+}
+
+/* lanewise sqrt of the vectors used.  These cannot be always_inline,
+ * which would inline them into the kernel templates before those are
+ * inlined into a caller with the target; they are inlined there
+ * later. */
+static inline __attribute__ ((target ("avx2")))
+v4df Sqrt(const v4df &x)
+{
+  return (v4df)_mm256_sqrt_pd((__m256d)x);
+}
+static inline __attribute__ ((target ("avx2")))
+v8sf Sqrt(const v8sf &x)
+{
+  return (v8sf)_mm256_sqrt_ps((__m256)x);
+}
+static inline __attribute__ ((target ("avx512f")))
+v8df Sqrt(const v8df &x)
+{
+  return (v8df)_mm512_maskz_sqrt_pd(0xFF, (__m512d)x);
+}
+static inline __attribute__ ((target ("avx512f")))
+v16sf Sqrt(const v16sf &x)
+{
+  return (v16sf)_mm512_maskz_sqrt_ps(0xFFFF, (__m512)x);
+}
+
+/* Natural log of positive normal numbers, lanewise, to within 1 ulp:
+ * x = 2^k m with m in [sqrt(1/2), sqrt(2)) & log(m) from the odd
+ * series of log((1+s)/(1-s)), s = (m-1)/(m+1), with the coefficients
+ * of fdlibm's e_log.c */
+template <class V, class I>
+static inline __attribute__ ((always_inline))
+V Log(const V &x)
+{
+  const Type ln2_hi = 6.93147180369123816490e-01;
+  const Type ln2_lo = 1.90821492927058770002e-10;
+  const Type Lg1 = 6.666666666666735130e-01;
+  const Type Lg2 = 3.999999999940941908e-01;
+  const Type Lg3 = 2.857142874366239149e-01;
+  const Type Lg4 = 2.222219843214978396e-01;
+  const Type Lg5 = 1.818357216161805012e-01;
+  const Type Lg6 = 1.531383769920937332e-01;
+  const Type Lg7 = 1.479819860511658591e-01;
+
+  I bits = (I)x;
+  I e = (bits >> 52) - 1023;
+  V m = (V)((bits & 0x000FFFFFFFFFFFFFLL) | 0x3FF0000000000000LL);
+  I big = (I)(m > 1.4142135623730951);
+  m = Blend(big, m*0.5, m);
+  e -= big;  /* mask is -1 */
+
+  /* exact int64 -> double for |e| < 2^51: add to the bits of 1.5*2^52 */
+  V k = (V)(e + 0x4338000000000000LL) - 6755399441055744.0;
+
+  V f = m - 1.0;
+  V s = f/(2.0 + f);
+  V z = s*s;
+  V w = z*z;
+  V t1 = w*(Lg2 + w*(Lg4 + w*Lg6));
+  V t2 = z*(Lg1 + w*(Lg3 + w*(Lg5 + w*Lg7)));
+  V R = t2 + t1;
+  V hfsq = 0.5*f*f;
+  return k*ln2_hi - ((hfsq - (s*(hfsq + R) + k*ln2_lo)) - f);
+}
+
+/* Single-precision log of positive normal numbers, lanewise, to
+ * within 2 ulp, by the polynomial of Cephes' logf */
+template <class F, class J>
+static inline __attribute__ ((always_inline))
+F LogF(const F &x)
+{
+  J bits = (J)x;
+  J e = (bits >> 23) - 127;
+  F m = (F)((bits & 0x007FFFFF) | 0x3F800000);
+  J big = (J)(m > 1.41421356f);
+  m = Blend(big, m*0.5f, m);
+  e -= big;
+  F k = __builtin_convertvector(e, F);
+
+  F f = m - 1.0f;
+  F z = f*f;
+  F y = ((((((((7.0376836292e-2f*f - 1.1514610310e-1f)*f
+	       + 1.1676998740e-1f)*f - 1.2420140846e-1f)*f
+	     + 1.4249322787e-1f)*f - 1.6668057665e-1f)*f
+	   + 2.0000714765e-1f)*f - 2.4999993993e-1f)*f
+	 + 3.3333331174e-1f)*f*z;
+  y += k*-2.12194440e-4f;
+  y += -0.5f*z;
+  return f + y + k*0.693359375f;
+}
+
+/* loads the L = lanes of V numbers from u, padding a partial last vector
+ * with 0.5 */
+template <class V, class I>
+static inline __attribute__ ((always_inline))
+V Load(const Type *u, unsigned int m)
+{
+  V v;
+  if (m == sizeof(V)/sizeof(Type))
+    {
+      memcpy(&v, u, sizeof(V));
+    }
+  else
+    {
+      v = (V)((I){} + 0x3FE0000000000000LL);  /* 0.5 */
+      memcpy(&v, u, m*sizeof(Type));
+    }
+  return v;
+}
+
+/* stores the first m numbers of v at x, the whole vector in one
+ * fixed-size copy when m = lanes */
+template <class V>
+static inline __attribute__ ((always_inline))
+void Store(Type *x, const V &v, unsigned int m)
+{
+  memcpy(x, &v, m == sizeof(V)/sizeof(Type) ? sizeof(V) : m*sizeof(Type));
+}
+
+/* StandardNormalBSM() on whole vectors of u: both the central & the
+ * tail approximation are computed for every lane and blended, so there
+ * is no branch, and the tail takes min(u, 1-u), which keeps the logs
+ * of central lanes finite.  Stores mean + sd*x. */
+template <class V, class I>
+inline __attribute__ ((always_inline))
+void InverseTransformation::BSMKernel(const Type *u, unsigned int n,
+				      Type mean, Type sd, Type *x)
+{
+  const unsigned int L = sizeof(V)/sizeof(Type);
+
+  for (unsigned int i = 0; i < n; i += L)
+    {
+      unsigned int m = std::min(L, n - i);
+      V v = Load<V, I>(u + i, m);
+
+      V y = v - 0.5;
+      V r = y*y;
+      V central = y*(((a3*r + a2)*r + a1)*r + a0) /
+	((((b3*r + b2)*r + b1)*r + b0)*r + 1);
+
+      const V zero = {};
+      I upper = (I)(y > zero);
+      V t = Log<V, I>(-Log<V, I>(Blend(upper, 1.0 - v, v)));
+      V tail = c0 + t*(c1 + t*(c2 + t*(c3 + t*(c4 + t*(c5 + t*(c6 + t*(c7
+							  + t*c8)))))));
+      tail = Blend((I)(y < zero), -tail, tail);
+
+      V absY = (V)((I)y & 0x7FFFFFFFFFFFFFFFLL);
+      I inCentre = (I)(absY < zero + 0.42);
+      V z = mean + sd*Blend(inCentre, central, tail);
+      Store(x + i, z, m);
+    }
+}
+
+/* StandardNormalAS241() on whole vectors, blending as above; the two
+ * tail regions share one rational function with blended
+ * coefficients */
+template <class V, class I>
+static inline __attribute__ ((always_inline))
+void AS241Kernel(const Type *u, unsigned int n, Type mean, Type sd,
+		 Type *x)
+{
+  const unsigned int L = sizeof(V)/sizeof(Type);
+  const V zero = {};
+
+  for (unsigned int i = 0; i < n; i += L)
+    {
+      unsigned int m = std::min(L, n - i);
+      V v = Load<V, I>(u + i, m);
+
+      V q = v - 0.5;
+      V r = 0.180625 - q*q;
+      V central = q*Polynomial<8>(as241A, r)/Polynomial<8>(as241B, r);
+
+      I lower = (I)(q < zero);
+      V t = Sqrt(-Log<V, I>(Blend(lower, v, 1.0 - v)));
+      I far = (I)(t > zero + 5.0);
+      t -= Blend(far, zero + 5.0, zero + 1.6);
+      V num = zero + Blend(far, zero + as241E[7], zero + as241C[7]);
+      V den = zero + Blend(far, zero + as241F[7], zero + as241D[7]);
+      for (int k = 6; k >= 0; --k)
+	{
+	  num = num*t + Blend(far, zero + as241E[k], zero + as241C[k]);
+	  den = den*t + Blend(far, zero + as241F[k], zero + as241D[k]);
+	}
+      V tail = num/den;
+      tail = Blend(lower, -tail, tail);
+
+      V absQ = (V)((I)q & 0x7FFFFFFFFFFFFFFFLL);
+      I inCentre = (I)(absQ <= zero + 0.425);
+      V z = mean + sd*Blend(inCentre, central, tail);
+      Store(x + i, z, m);
+    }
+}
+
+/* StandardNormalFast() on vectors of L doubles (V) converted to L
+ * floats (F) for the arithmetic, blending as above */
+template <class V, class I, class F, class J>
+static inline __attribute__ ((always_inline))
+void FastKernel(const Type *u, unsigned int n, Type mean, Type sd,
+		Type *x)
+{
+  const unsigned int L = sizeof(V)/sizeof(Type);
+  const V zero = {};
+  const F zeroF = {};
+
+  for (unsigned int i = 0; i < n; i += L)
+    {
+      unsigned int m = std::min(L, n - i);
+      V v = Load<V, I>(u + i, m);
+
+      /* the tail probability in double, so u near 1 keeps its digits */
+      V qd = v - 0.5;
+      I lowerD = (I)(qd < zero);
+      V p = Blend(lowerD, v, 1.0 - v);
+      p = Blend((I)(p < zero + 1.17549435e-38), zero + 1.17549435e-38, p);
+      F q = __builtin_convertvector(qd, F);
+      F pF = __builtin_convertvector(p, F);
+
+      F r = 0.180625f - q*q;
+      F central = q*Polynomial<4>(ppnd7A, r)/Polynomial<4>(ppnd7B, r);
+
+      F t = Sqrt(-LogF<F, J>(pF));
+      J far = (J)(t > zeroF + 5.0f);
+      t -= Blend(far, zeroF + 5.0f, zeroF + 1.6f);
+      F num = zeroF + Blend(far, zeroF + ppnd7E[3], zeroF + ppnd7C[3]);
+      F den = zeroF + Blend(far, zeroF + ppnd7F[2], zeroF + ppnd7D[2]);
+      for (int k = 2; k >= 0; --k)
+	{
+	  num = num*t + Blend(far, zeroF + ppnd7E[k], zeroF + ppnd7C[k]);
+	}
+      for (int k = 1; k >= 0; --k)
+	{
+	  den = den*t + Blend(far, zeroF + ppnd7F[k], zeroF + ppnd7D[k]);
+	}
+      F tail = num/den;
+      tail = Blend((J)(q < zeroF), -tail, tail);
+
+      F absQ = (F)((J)q & 0x7FFFFFFF);
+      J inCentre = (J)(absQ <= zeroF + 0.425f);
+      V z = mean + sd*__builtin_convertvector(Blend(inCentre, central,
+						    tail), V);
+      Store(x + i, z, m);
+    }
+}
+
+void __attribute__ ((target ("avx2,fma")))
+InverseTransformation::NormalAVX2(InverseNormalMethod method,
+				  const Type *u, unsigned int n,
+				  Type mean, Type sd, Type *x)
+{
+  switch (method)
+    {
+    case INVERSE_NORMAL_AS241:
+      AS241Kernel<v4df, v4di>(u, n, mean, sd, x);
+      break;
+    case INVERSE_NORMAL_FAST:
+      FastKernel<v8df, v8di, v8sf, v8si>(u, n, mean, sd, x);
+      break;
+    case INVERSE_NORMAL_BSM:
+    default:
+      BSMKernel<v4df, v4di>(u, n, mean, sd, x);
+    }
+}
+
+void __attribute__ ((target ("avx512f,avx512dq")))
+InverseTransformation::NormalAVX512(InverseNormalMethod method,
+				    const Type *u, unsigned int n,
+				    Type mean, Type sd, Type *x)
+{
+  switch (method)
+    {
+    case INVERSE_NORMAL_AS241:
+      AS241Kernel<v8df, v8di>(u, n, mean, sd, x);
+      break;
+    case INVERSE_NORMAL_FAST:
+      FastKernel<v16df, v16di, v16sf, v16si>(u, n, mean, sd, x);
+      break;
+    case INVERSE_NORMAL_BSM:
+    default:
+      BSMKernel<v8df, v8di>(u, n, mean, sd, x);
+    }
+}
+
+#endif
+
+/* without AVX2 two-lane vector kernels are slower than the scalar
+ * branches, so this is the scalar code */
+void InverseTransformation::NormalGeneric(InverseNormalMethod method,
+					  const Type *u, unsigned int n,
+					  Type mean, Type sd, Type *x)
+{
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      x[i] = mean + sd*StandardNormal(method, u[i]);
+    }
+}
+
+typedef void (*NormalBatchFunction)(InverseNormalMethod, const Type*,
+				    unsigned int, Type, Type, Type*);
+
+/* Batch inverse transformation: x[i] = mean + sd*(normal quantile of
+ * u[i]) for i < n, by the approximation selected.  Runs on AVX-512
+ * or AVX2 vectors when the CPU has them, chosen on the first call,
+ * else on the scalar code of Normal().  The vector code takes its own
+ * logs and fuses multiply-adds, so its values differ from Normal()'s
+ * in the last bits (AVX2 & AVX-512 agree bitwise).  The standard
+ * deviation is passed in, so its sqrt is taken once per column rather
+ * than per number.  x may be u.  Thread-safe.
+ */
+void InverseTransformation::Normal(const Type *u, unsigned int n,
+				   Type mean, Type sd, Type *x) const
+{
+  static const NormalBatchFunction normal = []()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f")
+	  && __builtin_cpu_supports("avx512dq"))
+	return &NormalAVX512;
+      if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+	return &NormalAVX2;
+#endif
+      return &NormalGeneric;
+    }();
+
+  normal(method, u, n, mean, sd, x);
 }
 
 /* Function Uniform transforms a Unif(0,1) random number to a
@@ -98,6 +611,17 @@ Type InverseTransformation::Uniform(Type u, Type a, Type b)
   return (b-a)*u + a;
 }
 
+/* Function Triangular transforms a Unif(0,1) random number to the
+ * triangular distro on [a,b] with mode c
+ */
+Type InverseTransformation::Triangular(Type u, Type a, Type c, Type b)
+{
+  Type split = (c - a)/(b - a);  /* CDF at the mode */
+  if (u < split)
+    return a + sqrt(u*(b - a)*(c - a));
+  return b - sqrt((1 - u)*(b - a)*(b - c));
+}
+
 /* Function AndersonDarlingNormal computes the Anderson Darling test
  * statistic for a standard normal distribution.  The vector "values"
  * is sorted in this function.  This function
@@ -3,6 +3,21 @@
  * method of drawing numbers from a distribution.  In computing Sobol'
  * indices, this class is used to draw model parameters from their
  * respective distributions.
+ *
+ * Normal() inverts the normal CDF by one of three approximations,
+ * chosen per object (InverseNormalMethod): Beasley-Springer-Moro, the
+ * default, whose tail needs two logs; Wichura's AS241 (PPND16), one
+ * log & one sqrt, accurate to double precision; & AS241's PPND7 in
+ * single precision, cut off at min(u, 1-u) = FLT_MIN (|x| = 13.2).
+ * Max relative errors & times per number (InverseNormalBenchmark.cpp,
+ * one core of an AVX-512 Xeon VM, blocks of 512 in cache; p =
+ * min(u, 1-u), upper tail down to p = 2^-53, checked by symmetry;
+ * no NaNs):
+ *
+ *           0.075<u<0.925  1e-10<p<0.075  1e-38<p<1e-10  scalar  batch
+ *   BSM        1.4e-08        5.4e-11        1.1e-06     5.5 ns  4.8 ns
+ *   AS241      7.0e-16        7.7e-16        6.4e-16     8.4 ns  5.0 ns
+ *   fast       3.8e-07        4.0e-07        9.6e-04     4.8 ns  4.0 ns
  */
 
 #ifndef INVERSETRANSFORMATION_H
@@ -14,10 +29,18 @@
 #include "MersenneTwister.h"
 
 typedef double Type;
+
+/* Approximations of the inverse standard normal CDF:
+ * Beasley-Springer-Moro, Wichura's AS241 (PPND16, full double
+ * precision) & AS241's single-precision PPND7 computed in float */
+enum InverseNormalMethod {INVERSE_NORMAL_BSM, INVERSE_NORMAL_AS241,
+			  INVERSE_NORMAL_FAST};
+
 class InverseTransformation
 {
  private:
   MersenneTwister MT;
+  InverseNormalMethod method;  /* used by Normal() */
   /* values needed in BSM approximation of inverse normal CDF */
   static constexpr Type a0 = 2.50662823884;
   static constexpr Type a1 = -18.61500062529;
@@ -39,11 +62,33 @@ class InverseTransformation
   static constexpr Type c7 = 0.0000002888167364;
   static constexpr Type c8 = 0.0000003960315187;
 
+  static Type StandardNormalBSM(Type u);
+  /* vector kernel of BSM in the batch Normal() & the instances for
+   * the instruction sets chosen between at run time, see .cpp */
+  template <class V, class I>
+    static void BSMKernel(const Type *u, unsigned int n, Type mean,
+			  Type sd, Type *x);
+  static void NormalAVX2(InverseNormalMethod method, const Type *u,
+			 unsigned int n, Type mean, Type sd, Type *x);
+  static void NormalAVX512(InverseNormalMethod method, const Type *u,
+			   unsigned int n, Type mean, Type sd, Type *x);
+  static void NormalGeneric(InverseNormalMethod method, const Type *u,
+			    unsigned int n, Type mean, Type sd, Type *x);
+
  public:
-  InverseTransformation();
+  explicit InverseTransformation(InverseNormalMethod method_
+				 = INVERSE_NORMAL_BSM);
   Type GenPareto(Type k, Type sigma, Type theta);
   Type Normal(Type u, Type mean, Type variance);
+  void Normal(const Type *u, unsigned int n, Type mean, Type sd,
+	      Type *x) const;
+  Type StandardNormal(Type u) const;
+  static Type StandardNormal(InverseNormalMethod method, Type u);
+  void SetInverseNormalMethod(InverseNormalMethod method_)
+  {method = method_;}
+  InverseNormalMethod GetInverseNormalMethod() const {return method;}
   Type Uniform(Type u, Type a, Type b);
+  static Type Triangular(Type u, Type a, Type c, Type b);
   Type AndersonDarlingNormal(std::vector<Type> values, 
 			     Type mean,
 			     Type variance);
@@ -0,0 +1,164 @@
+/* Generating vector of the extensible rank-1 lattice of
+ * LatticeGenerator (SampleGenerator.h), for LATTICE_DIM coordinates
+ * and up to 2^LATTICE_LOG2_N points.  Written by LatticeVectorsCBC.cpp
+ * (see LatticeVectorsCBCScript.sh), a fast component-by-component
+ * construction of embedded lattice sequences after
+ *
+ *   Cools, R., Kuo, F. Y., & Nuyens, D., Constructing embedded lattice
+ *   rules for multivariate integration.  SIAM Journal on Scientific
+ *   Computing, 2006, Vol 28, No 6, 2162--2188.
+ *
+ * in base 2 for n = 2^10..2^20, choosing each z_j to minimize the
+ * worst of the squared worst-case errors P_2 (Korobov space of
+ * smoothness 2, product weights gamma_j = 1/j^2) over those n, each
+ * relative to its value for the best z_j at that n alone, and no z_j
+ * equal to z_i or 2^20 - z_i, i < j.  z_1 = 1.
+ *
+ * Check: worst-case error e_n of the first s coordinates, evaluated
+ * directly over the points, against the mean over 8 random odd
+ * vectors; fft is the largest relative difference between the e_n^2
+ * the construction predicted (by FFT) and the direct ones, over all n.
+ *
+ *     s   e_2^10   random   e_2^15   random   e_2^20   random      fft
+ *     1 1.77e-03 1.77e-03 5.54e-05 5.54e-05 1.73e-06 1.73e-06  2.7e-08
+ *     2 8.99e-03 1.56e-02 2.80e-04 8.24e-04 1.07e-05 2.75e-05  3.9e-09
+ *     5 3.87e-02 6.56e-02 2.59e-03 8.68e-03 1.55e-04 3.98e-03  9.0e-12
+ *    10 5.79e-02 9.74e-02 5.10e-03 1.65e-02 3.89e-04 5.69e-03  9.7e-13
+ *    20 7.26e-02 1.11e-01 7.02e-03 1.92e-02 6.13e-04 6.02e-03  2.0e-13
+ *    50 8.16e-02 1.21e-01 8.40e-03 2.07e-02 7.95e-04 6.21e-03  2.1e-13
+ *   100 8.49e-02 1.25e-01 8.93e-03 2.12e-02 8.67e-04 6.30e-03  1.6e-13
+ *   200 8.66e-02 1.26e-01 9.22e-03 2.15e-02 9.07e-04 6.33e-03  9.3e-14
+ *   500 8.76e-02 1.27e-01 9.40e-03 2.17e-02 9.32e-04 6.36e-03  1.8e-13
+ *  1000 8.80e-02 1.28e-01 9.46e-03 2.18e-02 9.41e-04 6.38e-03  2.5e-13
+ */
+
+#include "SampleGenerator.h"
+
+const unsigned int lattice_vector[] =
+{
+	1, 182851, 94973, 248991, 279483, 230169, 457847, 100173,
+	7507, 302487, 368767, 371797, 251581, 221569, 402755, 312629,
+	411369, 57009, 89625, 302935, 487635, 256609, 390635, 260591,
+	26705, 309323, 433447, 354939, 142231, 515399, 473649, 45975,
+	76493, 408511, 324209, 486409, 88947, 95645, 397775, 245653,
+	139083, 508317, 151021, 154845, 193639, 218349, 107217, 232421,
+	311511, 174167, 266467, 219115, 143643, 355945, 19759, 82325,
+	34903, 14561, 129949, 402079, 136209, 247027, 191185, 499771,
+	288931, 396253, 329699, 83065, 399005, 176105, 269113, 398309,
+	256305, 91985, 293399, 78873, 10489, 124905, 78039, 458407,
+	322163, 236873, 295035, 66915, 161581, 209871, 49647, 326201,
+	44913, 291045, 77279, 198297, 428335, 63779, 299717, 257723,
+	475599, 384241, 488311, 311419, 331047, 4433, 88327, 453391,
+	194663, 30679, 41701, 482805, 135691, 194205, 430693, 223247,
+	297195, 204839, 66543, 63149, 285707, 108579, 416683, 40881,
+	406467, 123721, 268299, 509423, 52115, 111507, 411637, 458267,
+	75311, 326901, 502269, 242961, 103667, 15163, 519769, 370417,
+	245891, 256675, 412279, 148205, 89459, 132527, 445449, 83697,
+	488031, 515011, 351081, 5623, 169633, 174053, 506731, 350095,
+	111859, 29391, 218823, 387599, 279121, 454885, 84193, 127175,
+	213417, 94083, 132347, 413209, 269161, 237065, 374335, 306493,
+	252497, 33769, 269005, 359755, 342491, 340061, 516017, 263899,
+	445849, 512327, 355401, 217589, 225233, 377131, 294691, 504865,
+	90195, 322233, 146675, 327353, 400599, 8979, 242009, 54299,
+	39033, 164203, 13257, 423819, 225073, 415771, 137277, 54485,
+	435229, 138145, 278355, 57261, 269931, 301709, 25779, 297743,
+	50891, 167567, 491095, 451359, 196503, 489221, 441687, 516393,
+	425481, 500765, 522575, 235099, 242733, 434339, 88623, 378779,
+	120463, 191139, 313287, 221895, 67493, 113427, 118357, 301427,
+	296103, 359463, 339315, 24857, 423107, 222957, 447635, 253789,
+	293561, 355125, 416043, 51675, 172883, 254985, 493843, 310605,
+	466387, 321705, 481667, 522653, 323257, 149341, 105687, 19849,
+	349845, 494947, 160179, 375661, 129387, 60163, 99719, 154937,
+	142997, 496415, 222271, 482741, 352815, 399247, 244241, 203379,
+	380185, 135849, 199983, 429595, 311119, 404461, 186989, 35731,
+	249561, 141565, 85427, 294747, 444803, 459943, 102931, 123163,
+	215825, 408619, 354745, 375709, 9043, 236785, 461187, 71741,
+	142937, 326695, 14257, 73029, 522169, 148235, 261557, 476005,
+	188533, 196731, 485439, 412585, 178065, 130741, 55417, 292601,
+	19569, 461897, 196183, 416843, 362437, 187453, 252885, 338731,
+	411555, 155865, 396889, 501815, 501619, 310291, 87513, 300325,
+	220211, 502429, 453771, 267541, 35881, 301911, 329851, 107497,
+	34117, 421981, 245825, 435265, 162899, 250855, 81327, 17645,
+	58493, 98775, 460529, 465493, 313577, 120303, 106425, 295187,
+	282123, 349395, 282927, 514095, 278951, 141669, 396861, 132549,
+	260075, 155873, 79515, 335089, 344559, 101229, 57431, 67635,
+	31275, 308109, 496493, 49625, 453869, 137885, 165867, 403809,
+	429577, 398573, 503009, 426965, 75295, 414117, 366621, 264541,
+	158029, 30221, 439285, 72049, 476299, 84323, 516059, 394255,
+	366651, 522689, 128057, 226161, 19507, 125261, 511401, 441981,
+	96335, 354797, 12617, 184041, 248777, 330077, 313365, 9283,
+	30941, 387667, 48061, 254691, 105527, 351435, 307307, 69197,
+	44531, 298509, 127547, 297235, 353449, 175151, 5967, 313403,
+	446759, 197807, 75661, 366109, 104469, 138967, 12593, 109367,
+	322493, 523197, 313123, 78745, 94275, 39871, 193083, 240995,
+	50373, 192185, 342237, 386899, 216809, 501161, 55595, 26827,
+	444195, 188251, 71913, 36293, 331203, 402067, 258935, 148679,
+	330833, 54535, 71033, 223151, 516183, 194173, 68407, 65033,
+	336713, 435613, 257119, 6557, 32691, 191111, 351383, 447885,
+	322525, 169463, 321233, 3991, 170807, 462251, 163915, 186855,
+	144029, 146015, 280073, 377491, 80439, 41375, 380909, 39755,
+	326025, 89147, 235761, 406761, 129473, 139153, 482697, 448953,
+	124175, 177393, 236969, 493711, 145353, 357557, 457553, 229767,
+	355831, 80067, 132313, 370743, 500939, 426311, 520763, 188857,
+	83297, 140559, 401373, 219623, 411669, 500919, 269297, 398199,
+	165811, 463263, 486231, 435189, 462457, 263135, 373699, 205009,
+	67019, 438867, 114505, 39783, 383063, 6475, 92973, 429129,
+	273627, 416753, 1427, 239677, 257015, 203593, 6989, 363227,
+	4899, 457013, 59409, 68945, 14135, 56849, 444769, 98151,
+	24175, 112017, 112239, 303505, 391569, 452207, 381905, 246829,
+	106429, 401561, 22379, 236711, 449517, 485085, 59923, 150653,
+	9897, 64403, 62931, 134171, 493555, 337277, 225701, 189365,
+	489887, 375683, 218585, 351211, 480879, 293363, 336727, 235961,
+	120813, 470425, 260631, 11367, 423851, 18445, 86731, 8401,
+	282101, 328225, 205463, 391117, 396317, 385845, 27843, 56809,
+	209975, 20575, 112975, 47737, 466067, 258153, 422809, 453251,
+	4721, 276633, 467607, 97879, 48821, 403709, 170149, 30741,
+	14045, 132077, 324775, 194495, 250691, 77153, 302245, 269963,
+	141331, 470605, 219689, 388569, 305377, 505843, 280147, 166537,
+	329389, 487883, 311361, 359787, 421261, 484247, 239303, 304237,
+	483475, 477459, 238929, 84091, 71713, 264247, 235631, 269563,
+	434213, 170147, 271419, 448825, 459757, 165063, 316957, 403475,
+	138985, 58479, 61363, 17861, 142387, 327549, 86937, 137515,
+	406501, 103051, 268121, 453301, 200055, 223109, 448715, 468403,
+	229453, 147991, 289101, 29655, 297461, 522859, 173785, 342429,
+	268843, 425571, 411235, 162417, 206369, 471205, 114151, 155687,
+	135781, 309789, 46907, 224463, 92105, 401315, 154275, 456051,
+	374255, 326173, 199433, 192815, 197895, 134795, 124869, 316041,
+	309921, 22303, 241069, 59945, 464729, 152651, 147161, 43039,
+	65413, 57487, 296367, 427043, 153569, 165579, 160295, 184675,
+	268403, 127477, 176309, 475629, 43371, 160547, 433683, 441265,
+	29401, 349111, 459027, 346221, 16207, 343769, 239773, 195769,
+	109843, 32861, 517305, 46575, 203993, 336025, 177197, 234071,
+	167437, 323313, 212005, 103059, 313061, 355535, 225149, 392869,
+	317969, 111473, 173425, 388989, 371043, 490433, 313731, 141267,
+	79577, 203239, 242451, 366637, 212509, 497709, 423153, 74295,
+	133175, 117413, 198999, 172467, 278987, 346197, 232083, 141545,
+	470945, 365203, 453337, 259637, 506213, 410379, 223545, 63827,
+	501085, 519659, 243741, 91897, 5499, 20209, 187849, 90327,
+	512755, 369513, 24147, 33973, 254321, 477093, 39991, 318455,
+	363993, 237997, 255597, 171789, 516151, 455047, 363741, 232203,
+	390567, 212365, 503059, 97383, 497401, 294487, 283341, 128651,
+	221743, 39549, 326641, 173453, 68369, 204239, 143823, 2301,
+	270553, 124025, 385485, 41359, 61559, 71187, 435569, 308465,
+	328725, 460893, 138983, 213651, 292085, 467697, 246387, 164761,
+	84599, 500943, 170621, 146887, 400257, 336019, 55529, 521987,
+	488323, 84143, 283963, 445775, 135943, 466073, 99025, 206227,
+	225345, 15395, 468505, 447073, 88453, 437947, 298943, 30627,
+	424819, 416599, 81197, 311923, 171935, 215693, 359527, 18415,
+	454721, 106151, 419789, 269967, 258981, 280683, 150357, 449993,
+	355245, 220769, 241627, 259495, 139539, 269415, 493069, 202083,
+	13681, 356307, 416743, 75685, 70283, 336749, 392921, 170355,
+	347991, 59857, 67517, 21171, 443849, 334473, 138057, 385305,
+	301113, 461577, 369589, 374253, 432243, 177821, 118491, 140745,
+	421229, 360601, 245563, 306483, 74287, 134157, 190957, 400273,
+	10593, 278331, 98713, 379153, 468139, 416053, 53341, 209299,
+	515889, 210591, 150837, 62853, 377029, 19375, 78333, 450967,
+	199291, 155837, 202081, 171767, 507707, 467603, 171843, 244141,
+	411199, 286909, 322207, 328201, 508101, 88457, 329661, 91855,
+	203605, 65145, 404531, 318929, 276305, 374531, 452527, 242545,
+	431457, 159093, 25717, 438441, 283219, 296677, 133339, 326033,
+	117167, 29893, 68523, 173077, 313775, 72467, 101513, 6379,
+	390731, 67099, 176377, 8917, 407121, 75837, 247495, 122093,
+	199649, 514527, 36147, 330381, 119179, 498317, 419017, 290293,
+	311779, 56737, 41589, 159325, 205407, 220515, 94287, 318881
+};
@@ -0,0 +1,421 @@
+/* Builds the generating vector of LatticeVectors.cpp and writes that
+ * file to stdout: ./a.out > LatticeVectors.cpp.  Progress & the checks
+ * go to stderr.  Usage: ./a.out [dims] [random vectors]
+ *
+ * Fast component-by-component construction of an embedded lattice
+ * sequence in base 2 (Cools, Kuo & Nuyens 2006) for n = 2^m points,
+ * m = MIN_LOG2_N..LATTICE_LOG2_N.  The criterion is the squared
+ * worst-case error in the Korobov space of smoothness 2 with product
+ * weights gamma_j = 1/j^2,
+ *     e_m^2 = -1 + 1/n sum_k prod_j (1 + gamma_j omega({k z_j/n})),
+ *     omega(x) = 2 pi^2 (x^2 - x + 1/6),
+ * and z_j is the odd number < 2^LATTICE_LOG2_N minimizing
+ * max_m e_m^2(z)/min_z' e_m^2(z'), the first minimizer on a tie,
+ * among the z not yet chosen for another coordinate (as z or N - z).
+ *
+ * With N = 2^LATTICE_LOG2_N and p[k] the product over the coordinates
+ * chosen so far at point k of the N-point rule, the sum of e_m^2 at
+ * candidate z splits by the 2-adic valuation of k into
+ *     S_b(z) = sum_{o odd < 2^b} p[o N/2^b] omega({o z/2^b}),
+ * b = 1..m.  The odd residues mod 2^b are +-5^i, and omega(1 - x) =
+ * omega(x), so S_b at z = +-5^l is the cyclic correlation
+ * sum_i (q[5^i] + q[-5^i]) omega({5^(i+l)/2^b}) of length 2^(b-2),
+ * done by FFT: O(N log N) per coordinate instead of O(N^2).
+ *
+ * Check: for the first s coordinates of the vector, e_m is evaluated
+ * directly over the points (no FFT) and compared with the value the
+ * construction predicted, and with the mean e_m of random odd
+ * vectors.  The table of the direct values is written into the header
+ * comment of the output.
+ */
+
+#include "SampleGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#define MIN_LOG2_N 10  /* smallest embedded rule, 2^10 points */
+#define DIRECT_LOG2_N 10  /* S_b of b up to this summed directly */
+
+typedef std::complex<double> Complex;
+
+static const double pi = 3.14159265358979323846;
+
+static inline double Omega(double x)
+{
+  return 2*pi*pi*(x*x - x + 1.0/6);
+}
+
+/* In-place radix-2 FFT of a[0..n-1], n a power of 2 dividing the size
+ * of the twiddle table w (w[k] = exp(-2 pi i k/size)); inverse if
+ * sign > 0, unscaled */
+static void FFT(std::vector<Complex> &a, unsigned int n,
+		const std::vector<Complex> &w, int sign)
+{
+  for (unsigned int i = 1, j = 0; i < n; ++i)
+    {
+      unsigned int bit = n >> 1;
+      for (; j & bit; bit >>= 1)
+	j ^= bit;
+      j ^= bit;
+      if (i < j)
+	std::swap(a[i], a[j]);
+    }
+  for (unsigned int len = 2; len <= n; len <<= 1)
+    {
+      unsigned int step = w.size()/len;
+      for (unsigned int i = 0; i < n; i += len)
+	{
+	  for (unsigned int k = 0; k < len/2; ++k)
+	    {
+	      Complex t = w[k*step];
+	      if (sign > 0)
+		t = std::conj(t);
+	      Complex u = a[i + k], v = a[i + k + len/2]*t;
+	      a[i + k] = u + v;
+	      a[i + k + len/2] = u - v;
+	    }
+	}
+    }
+}
+
+/* The tables of one 2-adic level b: the residues 5^i mod 2^b, the
+ * exponent l of each odd residue r = +-5^l (at (r - 1)/2), and the FFT
+ * of omega({5^i/2^b}) */
+struct Level
+{
+  unsigned int L;  /* 2^(b-2) */
+  std::vector<unsigned int> power, log;
+  std::vector<Complex> omegaHat;
+};
+
+class CBC
+{
+ public:
+  const unsigned int M, N;  /* log2 of the largest rule, its size */
+  std::vector<double> p;  /* p[k], product at point k of the N-rule */
+
+  CBC(unsigned int M_) : M(M_), N(1u << M_), p(1u << M_, 1.0), S(M_ + 1)
+  {
+    twiddle.resize(N/4 > 1 ? N/4 : 1);
+    for (unsigned int k = 0; k < twiddle.size(); ++k)
+      {
+	twiddle[k] = std::polar(1.0, -2*pi*k/twiddle.size());
+      }
+
+    levels.resize(M + 1);
+    for (unsigned int b = DIRECT_LOG2_N + 1; b <= M; ++b)
+      {
+	Level &lv = levels[b];
+	unsigned int mod = 1u << b, mask = mod - 1;
+	lv.L = mod/4;
+	lv.power.resize(lv.L);
+	lv.log.resize(mod/2);
+	lv.omegaHat.resize(lv.L);
+	unsigned int x = 1;
+	for (unsigned int i = 0; i < lv.L; ++i)
+	  {
+	    lv.power[i] = x;
+	    lv.log[(x - 1)/2] = i;
+	    lv.log[((mod - x) & mask)/2] = i;
+	    lv.omegaHat[i] = Omega((double)x/mod);
+	    x = (x*5) & mask;
+	  }
+	FFT(lv.omegaHat, lv.L, twiddle, -1);
+      }
+  }
+
+  /* squared worst-case error of each rule 2^m, m = MIN_LOG2_N..M, at
+   * each odd candidate z < N (at (z - 1)/2, row m - MIN_LOG2_N) with
+   * one more coordinate of weight gamma */
+  void Errors(double gamma, std::vector<std::vector<double> > &e)
+  {
+    for (unsigned int b = 1; b <= M; ++b)
+      {
+	SumLevel(b);
+      }
+
+    e.assign(M - MIN_LOG2_N + 1, std::vector<double>(N/2));
+    std::vector<double> sum(N/2, 0.0);
+    for (unsigned int b = 1; b <= M; ++b)
+      {
+	unsigned int mask = (1u << b) - 1;
+	for (unsigned int z = 1; z < N; z += 2)
+	  {
+	    sum[z/2] += S[b][(z & mask)/2];
+	  }
+	if (b < MIN_LOG2_N)
+	  continue;
+
+	/* the 1 of e_m^2 = -1 + ... is taken off each p[k] before the
+	 * sum, a compensated one */
+	unsigned int n = 1u << b, spacing = N/n;
+	double P = 0, carry = 0;
+	for (unsigned int k = 0; k < n; ++k)
+	  {
+	    double y = (p[k*spacing] - 1) - carry, t = P + y;
+	    carry = (t - P) - y;
+	    P = t;
+	  }
+	std::vector<double> &em = e[b - MIN_LOG2_N];
+	for (unsigned int z = 1; z < N; z += 2)
+	  {
+	    em[z/2] = (P + gamma*(p[0]*Omega(0) + sum[z/2]))/n;
+	  }
+      }
+  }
+
+  /* appends coordinate z of weight gamma */
+  void Add(unsigned int z, double gamma)
+  {
+    for (unsigned int k = 0; k < N; ++k)
+      {
+	unsigned int r = (unsigned int)(((unsigned long long)k*z) & (N - 1));
+	p[k] *= 1 + gamma*Omega((double)r/N);
+      }
+  }
+
+ private:
+  std::vector<Complex> twiddle;
+  std::vector<Level> levels;
+  /* S[b][(r - 1)/2] = S_b at odd residue r mod 2^b */
+  std::vector<std::vector<double> > S;
+
+  void SumLevel(unsigned int b)
+  {
+    unsigned int mod = 1u << b, spacing = N/mod;
+    std::vector<double> &Sb = S[b];
+    Sb.assign(mod/2, 0.0);
+
+    if (b <= DIRECT_LOG2_N)
+      {
+	for (unsigned int r = 1; r < mod; r += 2)
+	  {
+	    double s = 0;
+	    for (unsigned int o = 1; o < mod; o += 2)
+	      {
+		s += p[o*spacing]*Omega((double)((o*r) & (mod - 1))/mod);
+	      }
+	    Sb[r/2] = s;
+	  }
+	return;
+      }
+
+    const Level &lv = levels[b];
+    std::vector<Complex> q(lv.L);
+    for (unsigned int i = 0; i < lv.L; ++i)
+      {
+	unsigned int x = lv.power[i];
+	q[i] = p[x*spacing] + p[(mod - x)*spacing];
+      }
+    FFT(q, lv.L, twiddle, -1);
+    for (unsigned int i = 0; i < lv.L; ++i)
+      {
+	q[i] = std::conj(q[i])*lv.omegaHat[i];
+      }
+    FFT(q, lv.L, twiddle, 1);
+    for (unsigned int r = 1; r < mod; r += 2)
+      {
+	Sb[r/2] = q[lv.log[r/2]].real()/lv.L;
+      }
+  }
+};
+
+/* squared worst-case errors of rules 2^MIN_LOG2_N..N of the first
+ * coordinates of p, evaluated over the points */
+static std::vector<double> DirectErrors(const std::vector<double> &p,
+					unsigned int M)
+{
+  std::vector<double> e;
+  for (unsigned int m = MIN_LOG2_N; m <= M; ++m)
+    {
+      unsigned int n = 1u << m, spacing = (1u << M)/n;
+      /* compensated sum of p - 1, whose mean is tiny next to 1 */
+      double sum = 0, carry = 0;
+      for (unsigned int k = 0; k < n; ++k)
+	{
+	  double y = (p[k*spacing] - 1) - carry, t = sum + y;
+	  carry = (t - sum) - y;
+	  sum = t;
+	}
+      e.push_back(sum/n);
+    }
+  return e;
+}
+
+int main(int argc, char** argv)
+{
+  unsigned int dims = argc > 1 ? atoi(argv[1]) : LATTICE_DIM;
+  unsigned int randomVectors = argc > 2 ? atoi(argv[2]) : 8;
+  const unsigned int M = LATTICE_LOG2_N, N = 1u << M;
+  const unsigned int rows = M - MIN_LOG2_N + 1;
+
+  /* coordinates at which the check is reported */
+  const unsigned int reported[] = {1, 2, 5, 10, 20, 50, 100, 200, 500,
+				   1000};
+  std::vector<unsigned int> checked;
+  for (unsigned int i = 0; i < sizeof(reported)/sizeof(*reported); ++i)
+    {
+      if (reported[i] <= dims)
+	checked.push_back(reported[i]);
+    }
+
+  CBC cbc(M);
+  std::vector<unsigned int> z(dims);
+  std::vector<std::vector<double> > e, predicted, direct;
+  /* z & N - z give the same (mirrored) column, so both are taken out
+   * once chosen: no two coordinates of the lattice coincide */
+  std::vector<bool> used(N/2, false);
+  for (unsigned int j = 0; j < dims; ++j)
+    {
+      double gamma = 1.0/((j + 1.0)*(j + 1.0));
+      cbc.Errors(gamma, e);
+      if (j == 0)
+	{
+	  z[j] = 1;
+	}
+      else
+	{
+	  std::vector<double> best(rows);
+	  for (unsigned int r = 0; r < rows; ++r)
+	    {
+	      best[r] = *std::min_element(e[r].begin(), e[r].end());
+	    }
+	  double bestWorst = HUGE_VAL;
+	  for (unsigned int c = 0; c < N/2; ++c)
+	    {
+	      if (used[c])
+		continue;
+	      double worst = 0;
+	      for (unsigned int r = 0; r < rows; ++r)
+		{
+		  worst = std::max(worst, e[r][c]/best[r]);
+		}
+	      if (worst < bestWorst)
+		{
+		  bestWorst = worst;
+		  z[j] = 2*c + 1;
+		}
+	    }
+	}
+      used[z[j]/2] = used[(N - z[j])/2] = true;
+      cbc.Add(z[j], gamma);
+
+      if (std::count(checked.begin(), checked.end(), j + 1))
+	{
+	  std::vector<double> pe(rows);
+	  for (unsigned int r = 0; r < rows; ++r)
+	    {
+	      pe[r] = e[r][z[j]/2];
+	    }
+	  predicted.push_back(pe);
+	  direct.push_back(DirectErrors(cbc.p, M));
+	}
+      if ((j + 1) % 50 == 0)
+	std::cerr << "coordinate " << j + 1 << " of " << dims << "\n";
+    }
+
+  /* random odd vectors, from a fixed-seed LCG */
+  std::vector<std::vector<double> > randomE(checked.size(),
+					     std::vector<double>(rows, 0));
+  unsigned long long state = 12345;
+  for (unsigned int v = 0; v < randomVectors; ++v)
+    {
+      std::vector<double> p(N, 1.0);
+      size_t c = 0;
+      for (unsigned int j = 0; j < dims && c < checked.size(); ++j)
+	{
+	  state = state*6364136223846793005ULL + 1442695040888963407ULL;
+	  unsigned int zr = (unsigned int)((state >> 33) & (N - 1)) | 1;
+	  double gamma = 1.0/((j + 1.0)*(j + 1.0));
+	  for (unsigned int k = 0; k < N; ++k)
+	    {
+	      unsigned int r = (unsigned int)(((unsigned long long)k*zr)
+					      & (N - 1));
+	      p[k] *= 1 + gamma*Omega((double)r/N);
+	    }
+	  if (j + 1 == checked[c])
+	    {
+	      std::vector<double> ed = DirectErrors(p, M);
+	      for (unsigned int r = 0; r < rows; ++r)
+		{
+		  randomE[c][r] += sqrt(ed[r])/randomVectors;
+		}
+	      ++c;
+	    }
+	}
+    }
+
+  /* worst relative difference of predicted & direct e_m^2 of each s */
+  std::vector<double> diff(checked.size(), 0.0);
+  for (size_t c = 0; c < checked.size(); ++c)
+    {
+      for (unsigned int r = 0; r < rows; ++r)
+	{
+	  diff[c] = std::max(diff[c], std::abs(predicted[c][r]
+					       - direct[c][r])
+			     /direct[c][r]);
+	}
+    }
+
+  printf("/* Generating vector of the extensible rank-1 lattice of\n"
+	 " * LatticeGenerator (SampleGenerator.h), for LATTICE_DIM "
+	 "coordinates\n"
+	 " * and up to 2^LATTICE_LOG2_N points.  Written by "
+	 "LatticeVectorsCBC.cpp\n"
+	 " * (see LatticeVectorsCBCScript.sh), a fast component-by-"
+	 "component\n"
+	 " * construction of embedded lattice sequences after\n"
+	 " *\n"
+	 " *   Cools, R., Kuo, F. Y., & Nuyens, D., Constructing embedded "
+	 "lattice\n"
+	 " *   rules for multivariate integration.  SIAM Journal on "
+	 "Scientific\n"
+	 " *   Computing, 2006, Vol 28, No 6, 2162--2188.\n"
+	 " *\n"
+	 " * in base 2 for n = 2^%u..2^%u, choosing each z_j to minimize "
+	 "the\n"
+	 " * worst of the squared worst-case errors P_2 (Korobov space of\n"
+	 " * smoothness 2, product weights gamma_j = 1/j^2) over those n, "
+	 "each\n"
+	 " * relative to its value for the best z_j at that n alone, and "
+	 "no z_j\n"
+	 " * equal to z_i or 2^%u - z_i, i < j.  z_1 = 1.\n"
+	 " *\n"
+	 " * Check: worst-case error e_n of the first s coordinates, "
+	 "evaluated\n"
+	 " * directly over the points, against the mean over %u random "
+	 "odd\n"
+	 " * vectors; fft is the largest relative difference between the "
+	 "e_n^2\n"
+	 " * the construction predicted (by FFT) and the direct ones, "
+	 "over all n.\n"
+	 " *\n"
+	 " *     s   e_2^%u   random   e_2^%u   random   e_2^%u   random"
+	 "      fft\n",
+	 MIN_LOG2_N, M, M, randomVectors, MIN_LOG2_N, (MIN_LOG2_N + M)/2,
+	 M);
+  for (size_t c = 0; c < checked.size(); ++c)
+    {
+      printf(" * %5u", checked[c]);
+      unsigned int cols[] = {0, (rows - 1)/2, rows - 1};
+      for (unsigned int i = 0; i < 3; ++i)
+	{
+	  printf(" %8.2e %8.2e", sqrt(direct[c][cols[i]]),
+		 randomE[c][cols[i]]);
+	}
+      printf(" %8.1e\n", diff[c]);
+    }
+  printf(" */\n\n#include \"SampleGenerator.h\"\n\n"
+	 "const unsigned int lattice_vector[] =\n{\n");
+  for (unsigned int j = 0; j < dims; ++j)
+    {
+      printf("%s%u%s", j % 8 == 0 ? "\t" : " ", z[j],
+	     j + 1 == dims ? "\n" : j % 8 == 7 ? ",\n" : ",");
+    }
+  printf("};\n");
+}
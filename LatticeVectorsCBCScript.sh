@@ -0,0 +1,6 @@
+#!/bin/bash
+
+g++ -O3 -std=c++0x LatticeVectorsCBC.cpp
+
+# ./a.out > LatticeVectors.cpp
+# ./a.out 100 > /dev/null
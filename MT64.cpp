@@ -7,11 +7,6 @@
 #include <cstdlib>
 #include "MT64.h"
 
-/* The array for the state vector */
-static unsigned long long mt[NN]; 
-/* mti==NN+1 means mt[NN] is not initialized */
-static int mti=NN+1; 
-
 /* initializes mt[NN] with a seed */
 void genRand_64::init_genrand64(unsigned long long seed)
 {
@@ -113,4 +108,3 @@ double genRand_64::genrand64_real3(void)
 
 unsigned long long genRand_64::length_64 = 4;
 unsigned long long genRand_64::init_64[4] = {0x12345ULL, 0x23456ULL, 0x34567ULL, 0x45678ULL};
-genRand_64* genRand_64::_instance=NULL;
\ No newline at end of file
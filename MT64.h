@@ -7,6 +7,7 @@
 #define _MT64_H
 
 #include <iostream>
+#include <mutex>
 
 #define NN 312
 #define MM 156
@@ -17,7 +18,16 @@
 
 class genRand_64{
 public:
-	static genRand_64* Instance(){if(_instance==NULL) _instance=new genRand_64();return _instance;}
+	//Process-wide generator seeded from the clock; callers sharing it
+	//across threads must hold InstanceMutex() while drawing.
+	static genRand_64* Instance(){static genRand_64 *_instance=new genRand_64();return _instance;}
+	static std::mutex& InstanceMutex(){static std::mutex _mutex;return _mutex;}
+	//Independent generator with its own state, seeded with seed.
+	explicit genRand_64(unsigned long long seed)
+	{
+		mti=NN+1;
+		init_genrand64(seed);
+	}
 	/* initializes mt[NN] with a seed */
 	void init_genrand64(unsigned long long seed);
 
@@ -45,10 +55,14 @@ public:
 private:
 	genRand_64()
 	{
+		mti=NN+1;
 		init_by_array64(init_64, length_64);
 	}
 	static unsigned long long init_64[4], length_64;
-	static genRand_64* _instance;
+	/* The array for the state vector */
+	unsigned long long mt[NN];
+	/* mti==NN+1 means mt[NN] is not initialized */
+	int mti;
 };
 
 
@@ -0,0 +1,600 @@
+#include "ParameterDistribution.h"
+#include "pdflib.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+/* Value-initialized descriptor of the given type & parameters, so
+ * the std::function members are empty */
+static ParameterDistribution Descriptor(DistroType type, Type p0 = 0,
+					Type p1 = 0, Type p2 = 0,
+					Type p3 = 0)
+{
+  ParameterDistribution d = ParameterDistribution();
+  d.type = type;
+  d.p[0] = p0;
+  d.p[1] = p1;
+  d.p[2] = p2;
+  d.p[3] = p3;
+  return d;
+}
+
+/* Descriptor factories */
+ParameterDistribution ParameterDistribution::Normal(Type mean,
+						    Type variance)
+{
+  return Descriptor(DISTRO_NORMAL, mean, variance);
+}
+
+ParameterDistribution ParameterDistribution::LogNormal(Type mu,
+						       Type sigma2)
+{
+  return Descriptor(DISTRO_LOGNORMAL, mu, sigma2);
+}
+
+ParameterDistribution ParameterDistribution::Uniform(Type a, Type b)
+{
+  return Descriptor(DISTRO_UNIFORM, a, b);
+}
+
+ParameterDistribution ParameterDistribution::
+TruncatedNormal(Type mean, Type variance, Type lower, Type upper)
+{
+  return Descriptor(DISTRO_TRUNCATED_NORMAL, mean, variance, lower, upper);
+}
+
+ParameterDistribution ParameterDistribution::Beta(Type alpha, Type beta,
+						  Type a, Type b)
+{
+  return Descriptor(DISTRO_BETA, alpha, beta, a, b);
+}
+
+ParameterDistribution ParameterDistribution::Gamma(Type shape,
+						   Type scale)
+{
+  return Descriptor(DISTRO_GAMMA, shape, scale);
+}
+
+ParameterDistribution ParameterDistribution::InverseGamma(Type shape,
+							  Type scale)
+{
+  return Descriptor(DISTRO_INVERSE_GAMMA, shape, scale);
+}
+
+ParameterDistribution ParameterDistribution::Triangular(Type a, Type c,
+							Type b)
+{
+  return Descriptor(DISTRO_TRIANGULAR, a, c, b);
+}
+
+ParameterDistribution ParameterDistribution::
+Custom(const InverseCDF &inverseCDF)
+{
+  ParameterDistribution d = Descriptor(DISTRO_INVERSE_CDF);
+  d.inverseCDF = inverseCDF;
+  return d;
+}
+
+ParameterDistribution ParameterDistribution::
+Tabulated(const TabulatedInverseCDF::Density &density, Type lower,
+	  Type upper, Type center, Type scale)
+{
+  ParameterDistribution d = Descriptor(DISTRO_TABULATED, lower, upper,
+				       center, scale);
+  d.density = density;
+  return d;
+}
+
+typedef TransformPlan::Step Step;
+
+/* standard normal CDF, to double precision */
+static inline Type Phi(Type z)
+{
+  return 0.5*erfc(-z*M_SQRT1_2);
+}
+
+/* The column transforms.  c[] holds, by distro:
+ *   normal, lognormal: c[0] = mean (of log x)
+ *   uniform: c[0] = a, c[1] = b - a
+ *   truncated normal: x = c[0] + c[1]*Phi^-1(c[2] + c[3]*u), with
+ *       c[1] = -sd for bounds above the mean, where the CDF is
+ *       taken of -x so that Phi stays in its accurate lower tail
+ *   beta, gamma, inverse gamma, tabulated: x = c[0] + c[1]*table(u),
+ *       the table being of the standard beta for the beta
+ *   triangular: c[0] = a, c[1] = (b-a)(c-a), c[2] = b,
+ *       c[3] = (b-a)(b-c), split at u = (c-a)/(b-a) = c[1]/(c[1]+c[3])
+ */
+
+static void NormalFromUniform(const Step &step,
+			      const InverseTransformation &invTrans,
+			      Type variance, const Type *u, Type *x,
+			      unsigned int B)
+{
+  invTrans.Normal(u, B, step.c[0], sqrt(variance), x);
+}
+
+static void NormalFromNormal(const Step &step,
+			     const InverseTransformation &,
+			     Type variance, const Type *z, Type *x,
+			     unsigned int B)
+{
+  Type mean = step.c[0], sd = sqrt(variance);
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      x[b] = mean + sd*z[b];
+    }
+}
+
+static void LogNormalFromUniform(const Step &step,
+				 const InverseTransformation &invTrans,
+				 Type variance, const Type *u, Type *x,
+				 unsigned int B)
+{
+  invTrans.Normal(u, B, step.c[0], sqrt(variance), x);
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      x[b] = exp(x[b]);
+    }
+}
+
+static void LogNormalFromNormal(const Step &step,
+				const InverseTransformation &,
+				Type variance, const Type *z, Type *x,
+				unsigned int B)
+{
+  Type mean = step.c[0], sd = sqrt(variance);
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      x[b] = exp(mean + sd*z[b]);
+    }
+}
+
+static void UniformFromUniform(const Step &step,
+			       const InverseTransformation &,
+			       Type, const Type *u, Type *x,
+			       unsigned int B)
+{
+  Type a = step.c[0], width = step.c[1];
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      x[b] = width*u[b] + a;
+    }
+}
+
+static void TruncatedNormalFromUniform(const Step &step,
+				       const InverseTransformation &invTrans,
+				       Type, const Type *u,
+				       Type *x, unsigned int B)
+{
+  Type base = step.c[2], slope = step.c[3];
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      x[b] = base + slope*u[b];
+    }
+  invTrans.Normal(x, B, step.c[0], step.c[1], x);
+}
+
+static void TableFromUniform(const Step &step,
+			     const InverseTransformation &,
+			     Type, const Type *u, Type *x,
+			     unsigned int B)
+{
+  (*step.table)(u, B, x);
+  Type a = step.c[0], width = step.c[1];
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      x[b] = width*x[b] + a;
+    }
+}
+
+/* both branches of InverseTransformation::Triangular() for every u,
+ * selected, so the loop vectorizes */
+static void TriangularFromUniform(const Step &step,
+				  const InverseTransformation &,
+				  Type, const Type *u, Type *x,
+				  unsigned int B)
+{
+  Type a = step.c[0], left = step.c[1], b_ = step.c[2], right = step.c[3];
+  Type split = left/(left + right);
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      Type lower = a + sqrt(u[b]*left);
+      Type upper = b_ - sqrt((1 - u[b])*right);
+      x[b] = u[b] < split ? lower : upper;
+    }
+}
+
+static void InverseCDFFromUniform(const Step &step,
+				  const InverseTransformation &,
+				  Type, const Type *u, Type *x,
+				  unsigned int B)
+{
+  step.inverseCDF(u, B, x);
+}
+
+/* From N(0,1) numbers for the distros without a direct form: u =
+ * Phi(z), then the transform from u */
+template <TransformPlan::ColumnTransform FromUniform>
+static void ViaUniform(const Step &step,
+		       const InverseTransformation &invTrans,
+		       Type variance, const Type *z, Type *x,
+		       unsigned int B)
+{
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      x[b] = Phi(z[b]);
+    }
+  FromUniform(step, invTrans, variance, x, x, B);
+}
+
+/* Resolves the descriptors of the parameters, in order, to the column
+ * transforms & their constants */
+void TransformPlan::Compile(const std::vector<ParameterDistribution>
+			    &distros)
+{
+  steps.assign(distros.size(), Step());
+  allNormal = true;
+
+  for (size_t j = 0; j < distros.size(); ++j)
+    {
+      const ParameterDistribution &d = distros[j];
+      Step &s = steps[j];
+      s.c[0] = s.c[1] = s.c[2] = s.c[3] = 0;
+      s.variance = d.HasVariance() ? d.p[1] : 0;
+      allNormal = allNormal && d.type == DISTRO_NORMAL;
+
+      switch (d.type)
+	{
+	case DISTRO_NORMAL:
+	  s.fromUniform = NormalFromUniform;
+	  s.fromNormal = NormalFromNormal;
+	  s.c[0] = d.p[0];
+	  break;
+	case DISTRO_LOGNORMAL:
+	  s.fromUniform = LogNormalFromUniform;
+	  s.fromNormal = LogNormalFromNormal;
+	  s.c[0] = d.p[0];
+	  break;
+	case DISTRO_UNIFORM:
+	  s.fromUniform = UniformFromUniform;
+	  s.fromNormal = ViaUniform<UniformFromUniform>;
+	  s.c[0] = d.p[0];
+	  s.c[1] = d.p[1] - d.p[0];
+	  break;
+	case DISTRO_TRUNCATED_NORMAL:
+	  {
+	    Type sd = sqrt(d.p[1]);
+	    Type alpha = (d.p[2] - d.p[0])/sd, beta = (d.p[3] - d.p[0])/sd;
+	    s.fromUniform = TruncatedNormalFromUniform;
+	    s.fromNormal = ViaUniform<TruncatedNormalFromUniform>;
+	    s.c[0] = d.p[0];
+	    if (alpha > 0)
+	      {
+		/* -x has bounds -beta < -alpha < 0 & u -> 1-u */
+		Type lo = Phi(-beta), hi = Phi(-alpha);
+		s.c[1] = -sd;
+		s.c[2] = hi;
+		s.c[3] = lo - hi;
+	      }
+	    else
+	      {
+		Type lo = Phi(alpha), hi = Phi(beta);
+		s.c[1] = sd;
+		s.c[2] = lo;
+		s.c[3] = hi - lo;
+	      }
+	  }
+	  break;
+	case DISTRO_BETA:
+	  {
+	    Type alpha = d.p[0], beta = d.p[1], sum = alpha + beta;
+	    s.table = std::make_shared<TabulatedInverseCDF>
+	      ([=](Type x) {return r8_beta_pdf(alpha, beta, x);}, 0, 1,
+	       alpha/sum, sqrt(alpha*beta/(sum + 1))/sum);
+	    s.c[0] = d.p[2];
+	    s.c[1] = d.p[3] - d.p[2];
+	  }
+	  break;
+	case DISTRO_GAMMA:
+	  {
+	    /* pdflib's gamma takes the rate 1/scale */
+	    Type shape = d.p[0], rate = 1/d.p[1];
+	    s.table = std::make_shared<TabulatedInverseCDF>
+	      ([=](Type x) {return r8_gamma_pdf(rate, shape, x);}, 0,
+	       HUGE_VAL, shape/rate, sqrt(shape)/rate);
+	    s.c[1] = 1;
+	  }
+	  break;
+	case DISTRO_INVERSE_GAMMA:
+	  {
+	    /* pdflib's "rate" of the inverse gamma is its scale; the bulk
+	     * is centred on the mode, as the mean & variance may not
+	     * exist */
+	    Type shape = d.p[0], scale = d.p[1], mode = scale/(shape + 1);
+	    s.table = std::make_shared<TabulatedInverseCDF>
+	      ([=](Type x) {return r8_invgam_pdf(scale, shape, x);}, 0,
+	       HUGE_VAL, mode, mode);
+	    s.c[1] = 1;
+	  }
+	  break;
+	case DISTRO_TABULATED:
+	  s.table = std::make_shared<TabulatedInverseCDF>
+	    (d.density, d.p[0], d.p[1], d.p[2], d.p[3]);
+	  s.c[1] = 1;
+	  break;
+	case DISTRO_TRIANGULAR:
+	  s.fromUniform = TriangularFromUniform;
+	  s.fromNormal = ViaUniform<TriangularFromUniform>;
+	  s.c[0] = d.p[0];
+	  s.c[1] = (d.p[2] - d.p[0])*(d.p[1] - d.p[0]);
+	  s.c[2] = d.p[2];
+	  s.c[3] = (d.p[2] - d.p[0])*(d.p[2] - d.p[1]);
+	  break;
+	case DISTRO_INVERSE_CDF:
+	  s.fromUniform = InverseCDFFromUniform;
+	  s.fromNormal = ViaUniform<InverseCDFFromUniform>;
+	  s.inverseCDF = d.inverseCDF;
+	  break;
+	}
+
+      if (s.table)
+	{
+	  s.fromUniform = TableFromUniform;
+	  s.fromNormal = ViaUniform<TableFromUniform>;
+	}
+    }
+}
+
+/* All-normal plan from rows {mean, variance}, the distroParams of
+ * SobolIndices */
+void TransformPlan::
+CompileNormal(const std::vector<std::vector<Type> > &distroParams)
+{
+  std::vector<ParameterDistribution> distros;
+  for (size_t j = 0; j < distroParams.size(); ++j)
+    {
+      distros.push_back(ParameterDistribution::
+			Normal(distroParams[j][0], distroParams[j][1]));
+    }
+  Compile(distros);
+}
+
+/* Cholesky factor of the n x n symmetric matrix a, row-major, in
+ * place: its lower triangle (the only one read) becomes L, a = LL',
+ * and the upper one is zeroed.  False, with a part factored, if a
+ * pivot is not above tol, i.e. a is not positive definite (or is
+ * nearly singular). */
+static bool CholeskyFactor(std::vector<Type> &a, int n, Type tol)
+{
+  for (int j = 0; j < n; ++j)
+    {
+      Type d = a[j*n + j];
+      for (int k = 0; k < j; ++k)
+	{
+	  d -= a[j*n + k]*a[j*n + k];
+	}
+      if (!(d > tol))
+	return false;
+      d = std::sqrt(d);
+      a[j*n + j] = d;
+      for (int i = j + 1; i < n; ++i)
+	{
+	  Type s = a[i*n + j];
+	  for (int k = 0; k < j; ++k)
+	    {
+	      s -= a[i*n + k]*a[j*n + k];
+	    }
+	  a[i*n + j] = s/d;
+	  a[j*n + i] = 0;
+	}
+    }
+  return true;
+}
+
+/* Sets the correlation matrix of the params' N(0,1) scores, dim x dim,
+ * symmetric positive definite with unit diagonal, or empty for
+ * independent params.  It is factored once, here.  A matrix of the
+ * wrong size, not symmetric or without a unit diagonal (to 1e-12), or
+ * not positive definite (a Cholesky pivot of 1e-10 or less) is
+ * reported on stderr and rejected: the call returns false and the
+ * plan keeps its previous correlation.  The correlation of non-normal
+ * params themselves is somewhat smaller than that of their scores. */
+bool TransformPlan::
+SetCorrelation(const std::vector<std::vector<Type> > &correlation)
+{
+  if (correlation.empty())
+    {
+      cholesky.clear();
+      return true;
+    }
+
+  const int n = steps.size();
+  bool valid = correlation.size() == (size_t)n;
+  for (int i = 0; valid && i < n; ++i)
+    {
+      valid = correlation[i].size() == (size_t)n
+	&& std::fabs(correlation[i][i] - 1) <= 1e-12;
+    }
+  for (int i = 0; valid && i < n; ++i)
+    {
+      for (int j = 0; valid && j < i; ++j)
+	{
+	  valid = std::fabs(correlation[i][j] - correlation[j][i]) <= 1e-12;
+	}
+    }
+  if (!valid)
+    {
+      std::cerr << "TransformPlan::SetCorrelation: the correlation must "
+		<< "be " << n << " x " << n << ", symmetric, with unit "
+		<< "diagonal\n";
+      return false;
+    }
+
+  /* L, row-major */
+  std::vector<Type> L(n*n);
+  for (int i = 0; i < n; ++i)
+    {
+      std::copy(correlation[i].begin(), correlation[i].end(),
+		L.begin() + i*n);
+    }
+  if (!CholeskyFactor(L, n, 1e-10))
+    {
+      std::cerr << "TransformPlan::SetCorrelation: the correlation is "
+		<< "not positive definite\n";
+      return false;
+    }
+  cholesky.swap(L);
+  return true;
+}
+
+/* Correlates B points of independent N(0,1) numbers in place, z_j <-
+ * sum_k L_jk z_k with column j of the points at z + j*stride.  Row j
+ * of Lz takes rows k <= j of z, so the rows are done last to first
+ * and need no scratch.  The points go in tiles whose dim columns stay
+ * in L1 while L is swept over them, each term an axpy over the tile
+ * that vectorizes; zeros of L (e.g. uncorrelated groups) are
+ * skipped. */
+void TransformPlan::Correlate(Type *z, unsigned int stride,
+			      unsigned int B) const
+{
+  const int n = steps.size();
+  const unsigned int tile = 128;
+
+  for (unsigned int first = 0; first < B; first += tile)
+    {
+      unsigned int nb = std::min(tile, B - first);
+      for (int j = n - 1; j >= 0; --j)
+	{
+	  const Type *L = cholesky.data() + j*n;
+	  Type *zj = z + j*stride + first;
+	  Type d = L[j];
+	  for (unsigned int b = 0; b < nb; ++b)
+	    {
+	      zj[b] *= d;
+	    }
+	  for (int k = 0; k < j; ++k)
+	    {
+	      if (L[k] == 0)
+		continue;
+	      const Type *zk = z + k*stride + first;
+	      Type l = L[k];
+	      for (unsigned int b = 0; b < nb; ++b)
+		{
+		  zj[b] += l*zk[b];
+		}
+	    }
+	}
+    }
+}
+
+/* Regression of the scores of the params not in given on those in
+ * given: for correlated N(0,1) scores z with correlation S = LL', the
+ * scores of the others given z_g are A z_g + e, A = S_og S_gg^-1, e
+ * independent of z_g.  So, z1 & z2 being two independent points,
+ * z2_o + A (z1_g - z2_g) is a draw of z_o given z1_g, see Mix().
+ * Costs O(dim^3), once per index set & computation, not per sample.
+ *
+ * Input:
+ *   given = given[j] is true if param j+1 is given
+ */
+TransformPlan::Conditional TransformPlan::
+Condition(const std::vector<bool> &given) const
+{
+  const int n = steps.size();
+  Conditional cond;
+  for (int j = 0; j < n; ++j)
+    {
+      (given[j] ? cond.given : cond.other).push_back(j);
+    }
+  const int g = cond.given.size(), o = cond.other.size();
+  cond.A.assign(o*g, 0);
+  if (g == 0 || o == 0)
+    return cond;
+
+  /* S_ij from row i & j of L */
+  auto S = [&](int i, int j) -> Type
+    {
+      const Type *li = cholesky.data() + i*n, *lj = cholesky.data() + j*n;
+      Type s = 0;
+      for (int k = 0; k <= std::min(i, j); ++k)
+	{
+	  s += li[k]*lj[k];
+	}
+      return s;
+    };
+
+  /* S_gg = MM' (positive definite as a principal submatrix of S) */
+  std::vector<Type> M(g*g);
+  for (int k = 0; k < g; ++k)
+    {
+      for (int l = 0; l <= k; ++l)
+	{
+	  M[k*g + l] = S(cond.given[k], cond.given[l]);
+	}
+    }
+  CholeskyFactor(M, g, 0);
+
+  /* row i of A solves S_gg a = S_g,other[i] */
+  for (int i = 0; i < o; ++i)
+    {
+      Type *a = cond.A.data() + i*g;
+      for (int k = 0; k < g; ++k)
+	{
+	  Type s = S(cond.given[k], cond.other[i]);
+	  for (int l = 0; l < k; ++l)
+	    {
+	      s -= M[k*g + l]*a[l];
+	    }
+	  a[k] = s/M[k*g + k];
+	}
+      for (int k = g - 1; k >= 0; --k)
+	{
+	  Type s = a[k];
+	  for (int l = k + 1; l < g; ++l)
+	    {
+	      s -= M[l*g + k]*a[l];
+	    }
+	  a[k] = s/M[k*g + k];
+	}
+    }
+  return cond;
+}
+
+/* Builds B points of correlated N(0,1) scores z, column j at
+ * z + j*stride, that take the given params from zGiven and draw the
+ * others given those, z_o = zOther_o + A (zGiven_g - zOther_g), A of
+ * cond (see Condition()).  zGiven & zOther are independent points of
+ * the joint distro, so z has it too and shares exactly the given
+ * params with zGiven; for independent params it is the plain
+ * pick-freeze mix.  Zeros of A (uncorrelated params) are skipped. */
+void TransformPlan::Mix(const Conditional &cond, const Type *zGiven,
+			const Type *zOther, Type *z, unsigned int stride,
+			unsigned int B) const
+{
+  const size_t g = cond.given.size();
+
+  for (size_t k = 0; k < g; ++k)
+    {
+      const Type *from = zGiven + cond.given[k]*stride;
+      std::copy(from, from + B, z + cond.given[k]*stride);
+    }
+  for (size_t i = 0; i < cond.other.size(); ++i)
+    {
+      const Type *a = cond.A.data() + i*g;
+      Type *zj = z + cond.other[i]*stride;
+      const Type *from = zOther + cond.other[i]*stride;
+      std::copy(from, from + B, zj);
+      for (size_t k = 0; k < g; ++k)
+	{
+	  if (a[k] == 0)
+	    continue;
+	  const Type *z1 = zGiven + cond.given[k]*stride;
+	  const Type *z2 = zOther + cond.given[k]*stride;
+	  Type ak = a[k];
+	  for (unsigned int b = 0; b < B; ++b)
+	    {
+	      zj[b] += ak*(z1[b] - z2[b]);
+	    }
+	}
+    }
+}
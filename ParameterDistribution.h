@@ -0,0 +1,159 @@
+/* Distributions of the model parameters.  A ParameterDistribution
+ * describes one parameter: normal, lognormal, uniform, truncated
+ * normal, beta, gamma, inverse gamma, triangular, a user-supplied
+ * inverse CDF or a density to be tabulated.  A
+ * TransformPlan is compiled once from the descriptors of all the
+ * parameters: each column gets the functions that transform a batch
+ * of Unif(0,1) (or N(0,1)) numbers to its distribution, with the
+ * constants of the distribution precomputed, so the sample loop calls
+ * one function per column & block and never switches on the type.
+ * Correlated params are set by the correlation of their N(0,1) scores
+ * (the Nataf model): the plan keeps its Cholesky factor, applies it
+ * to blocks of independent N(0,1) columns, and the columns then go
+ * to their distros by the transforms from N(0,1), x = F^-1(Phi(z)).
+ * For the pick-freeze points of the Sobol' estimators it also draws
+ * the scores of the other params given those of an index set (the
+ * Gaussian copula), see TransformPlan::Mix().
+ */
+
+#ifndef PARAMETERDISTRIBUTION_H
+#define PARAMETERDISTRIBUTION_H
+
+#include <vector>
+#include <functional>
+#include <memory>
+#include "InverseTransformation.h"
+#include "TabulatedInverseCDF.h"
+
+typedef double Type;
+
+enum DistroType {DISTRO_NORMAL, DISTRO_LOGNORMAL, DISTRO_UNIFORM,
+		 DISTRO_TRUNCATED_NORMAL, DISTRO_BETA, DISTRO_GAMMA,
+		 DISTRO_INVERSE_GAMMA, DISTRO_TRIANGULAR, DISTRO_INVERSE_CDF,
+		 DISTRO_TABULATED};
+
+/* User-supplied inverse CDF of a parameter: x[i] = F^-1(u[i]) for
+ * i < n, u[i] in (0,1).  x may be u. */
+typedef std::function<void(const Type *u, unsigned int n, Type *x)>
+  InverseCDF;
+
+/* Descriptor of one parameter's distribution, made by the factories
+ * below.  The normal & lognormal are the distros whose variance the
+ * uncertainties passed to SobolIndices replace (for the lognormal, the
+ * variance of log x); the other types ignore them. */
+struct ParameterDistribution
+{
+  DistroType type;
+  Type p[4];  /* parameters, in the order of the factory args */
+  InverseCDF inverseCDF;  /* DISTRO_INVERSE_CDF only */
+  TabulatedInverseCDF::Density density;  /* DISTRO_TABULATED only */
+
+  static ParameterDistribution Normal(Type mean, Type variance);
+  /* log x ~ N(mu, sigma2) */
+  static ParameterDistribution LogNormal(Type mu, Type sigma2);
+  static ParameterDistribution Uniform(Type a, Type b);
+  /* N(mean, variance) conditioned on [lower, upper] */
+  static ParameterDistribution TruncatedNormal(Type mean, Type variance,
+					       Type lower, Type upper);
+  /* Beta(alpha, beta) scaled to [a, b] */
+  static ParameterDistribution Beta(Type alpha, Type beta, Type a = 0,
+				    Type b = 1);
+  static ParameterDistribution Gamma(Type shape, Type scale);
+  /* 1/x ~ Gamma(shape, 1/scale) */
+  static ParameterDistribution InverseGamma(Type shape, Type scale);
+  /* on [a, b] with mode c */
+  static ParameterDistribution Triangular(Type a, Type c, Type b);
+  static ParameterDistribution Custom(const InverseCDF &inverseCDF);
+  /* any density on [lower, upper] (e.g. a pdflib r8_*_pdf), not
+   * necessarily normalized, by a TabulatedInverseCDF built with the
+   * given center & scale */
+  static ParameterDistribution
+    Tabulated(const TabulatedInverseCDF::Density &density, Type lower,
+	      Type upper, Type center, Type scale);
+
+  /* true for the normal & lognormal, whose p[1] is a variance */
+  bool HasVariance() const
+  {return type == DISTRO_NORMAL || type == DISTRO_LOGNORMAL;}
+};
+
+class TransformPlan
+{
+ public:
+  struct Step;
+  /* transforms B numbers in of a column to x (which may be in) with
+   * the given variance, if the distro has one */
+  typedef void (*ColumnTransform)(const Step &step,
+				  const InverseTransformation &invTrans,
+				  Type variance, const Type *in, Type *x,
+				  unsigned int B);
+
+  /* regression of the correlated N(0,1) scores of the params not in
+   * given on those in given, A = S_og S_gg^-1 (S the correlation), see
+   * Condition() */
+  struct Conditional
+  {
+    std::vector<int> given, other;  /* param numbers 0..dim-1 */
+    std::vector<Type> A;  /* other.size() x given.size(), row-major */
+  };
+
+  /* the transformation of one column */
+  struct Step
+  {
+    ColumnTransform fromUniform;  /* in = Unif(0,1) numbers */
+    ColumnTransform fromNormal;  /* in = N(0,1) numbers */
+    Type c[4];  /* precomputed constants of the distro */
+    Type variance;  /* variance used without uncertainties */
+    InverseCDF inverseCDF;
+    /* the inverse CDF table of a beta, gamma, inverse gamma or
+     * tabulated distro, built once & shared by copies of the plan */
+    std::shared_ptr<const TabulatedInverseCDF> table;
+  };
+
+ private:
+  std::vector<Step> steps;  /* one per parameter */
+  bool allNormal;
+  /* lower Cholesky factor L of the correlation of the N(0,1) scores,
+   * row-major, or empty if the params are independent */
+  std::vector<Type> cholesky;
+
+ public:
+  TransformPlan() : allNormal(true) {}
+  void Compile(const std::vector<ParameterDistribution> &distros);
+  void CompileNormal(const std::vector<std::vector<Type> > &distroParams);
+  bool SetCorrelation(const std::vector<std::vector<Type> > &correlation);
+  void Correlate(Type *z, unsigned int stride, unsigned int B) const;
+  Conditional Condition(const std::vector<bool> &given) const;
+  void Mix(const Conditional &cond, const Type *zGiven, const Type *zOther,
+	   Type *z, unsigned int stride, unsigned int B) const;
+
+  /* Transforms the B Unif(0,1) numbers at x, parameter j's column, to
+   * its distro in place; uncertainties (if not empty) replace the
+   * variances, as in SobolIndices::TransformToModelDomain() */
+  void FromUniform(int j, const InverseTransformation &invTrans, Type *x,
+		   unsigned int B,
+		   const std::vector<Type> &uncertainties) const
+  {
+    const Step &s = steps[j];
+    s.fromUniform(s, invTrans,
+		  uncertainties.empty() ? s.variance : uncertainties[j],
+		  x, x, B);
+  }
+
+  /* As above, from the B N(0,1) numbers at z (a sample bank column) */
+  void FromNormal(int j, const InverseTransformation &invTrans,
+		  const Type *z, Type *x, unsigned int B,
+		  const std::vector<Type> &uncertainties) const
+  {
+    const Step &s = steps[j];
+    s.fromNormal(s, invTrans,
+		 uncertainties.empty() ? s.variance : uncertainties[j],
+		 z, x, B);
+  }
+
+  /* true if every parameter is normal */
+  bool IsNormal() const {return allNormal;}
+  /* true if SetCorrelation() was given a matrix */
+  bool IsCorrelated() const {return !cholesky.empty();}
+  size_t size() const {return steps.size();}
+};
+#endif
@@ -0,0 +1,163 @@
+#include <cassert>
+#include "SampleGenerator.h"
+
+SampleGenerator* SampleGenerator::New(SamplerType type, unsigned int dim)
+{
+  switch (type)
+    {
+    case SAMPLER_SOBOL:
+      return new SobolSequenceGenerator(dim);
+    case SAMPLER_MONTE_CARLO:
+      return new MonteCarloGenerator(dim);
+    case SAMPLER_LATTICE:
+      return new LatticeGenerator(dim);
+    case SAMPLER_HALTON:
+    default:
+      return new HaltonGenerator(dim);
+    }
+}
+
+HaltonGenerator::HaltonGenerator(unsigned int dim_)
+  : dim(dim_)
+{
+  generator = new halton();
+  generator->init(dim, true, true);
+}
+
+HaltonGenerator::HaltonGenerator(const halton &master, unsigned int dim_)
+  : dim(dim_)
+{
+  generator = new halton(false);
+  generator->attach(master);
+}
+
+/* a worker sharing the bases, permutation & start of this sequence */
+SampleGenerator* HaltonGenerator::Clone() const
+{
+  return new HaltonGenerator(*generator, dim);
+}
+
+SobolSequenceGenerator::SobolSequenceGenerator(unsigned int dim_)
+  : dim(dim_)
+{
+  generator = new sobol_sequence();
+  generator->init(dim, true);
+}
+
+SobolSequenceGenerator::
+SobolSequenceGenerator(const sobol_sequence &master, unsigned int dim_)
+  : dim(dim_)
+{
+  generator = new sobol_sequence(false);
+  generator->attach(master);
+}
+
+/* a worker sharing the scrambled direction numbers of this sequence */
+SampleGenerator* SobolSequenceGenerator::Clone() const
+{
+  return new SobolSequenceGenerator(*generator, dim);
+}
+
+LatticeGenerator::LatticeGenerator(unsigned int dim_)
+  : dim(dim_), shift(dim_), next(dim_, 0)
+{
+  assert(dim <= LATTICE_DIM);
+  std::lock_guard<std::mutex> lock(genRand_64::InstanceMutex());
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      shift[d] = genRand_64::Instance()->genrand64_int64();
+    }
+}
+
+LatticeGenerator::LatticeGenerator(unsigned int dim_,
+				   const std::vector<uint64> &shift_)
+  : dim(dim_), shift(shift_), next(dim_, 0)
+{
+  assert(dim <= LATTICE_DIM && shift.size() == dim);
+}
+
+/* bits of x in reverse order: the radical inverse of x in base 2, in
+ * units of 2^-64 */
+static inline uint64 ReverseBits(uint64 x)
+{
+  x = __builtin_bswap64(x);
+  x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+  x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+  x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+  return x;
+}
+
+void LatticeGenerator::Generate(unsigned int firstCoordinate,
+				unsigned int numCoordinates,
+				unsigned int B, Type *out,
+				unsigned int stride)
+{
+  /* the coordinates of a call are normally at the same point, so the
+   * bit reversals are shared */
+  uint64 first = next[firstCoordinate - 1];
+  reversed.resize(B);
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      reversed[b] = ReverseBits(first + b);
+    }
+
+  for (unsigned int d = firstCoordinate - 1;
+       d < firstCoordinate - 1 + numCoordinates; ++d)
+    {
+      if (next[d] != first)
+	{
+	  first = next[d];
+	  for (unsigned int b = 0; b < B; ++b)
+	    {
+	      reversed[b] = ReverseBits(first + b);
+	    }
+	}
+      Type *column = out + (d - firstCoordinate + 1)*stride;
+      const uint64 z = lattice_vector[d], s = shift[d];
+      const uint64 *r = reversed.data();
+      for (unsigned int b = 0; b < B; ++b)
+	{
+	  uint64 u = r[b]*z + s;
+	  /* baker's transform, then the top 53 bits, centred: in (0,1) */
+	  u = (u ^ (0 - (u >> 63))) << 1;
+	  column[b] = ((int64)(u >> 11) + 0.5)*(1.0/9007199254740992.0);
+	}
+      next[d] = first + B;
+    }
+}
+
+MonteCarloGenerator::MonteCarloGenerator(unsigned int dim_)
+  : dim(dim_), next(dim_, 0)
+{
+  std::lock_guard<std::mutex> lock(genRand_64::InstanceMutex());
+  seed = genRand_64::Instance()->genrand64_int64();
+}
+
+MonteCarloGenerator::MonteCarloGenerator(unsigned int dim_, uint64 seed_)
+  : dim(dim_), seed(seed_), next(dim_, 0)
+{
+}
+
+void MonteCarloGenerator::Generate(unsigned int firstCoordinate,
+				   unsigned int numCoordinates,
+				   unsigned int B, Type *out,
+				   unsigned int stride)
+{
+  for (unsigned int d = firstCoordinate - 1;
+       d < firstCoordinate - 1 + numCoordinates; ++d)
+    {
+      Type *column = out + (d - firstCoordinate + 1)*stride;
+      uint64 n = next[d];
+      for (unsigned int b = 0; b < B; ++b, ++n)
+	{
+	  /* SplitMix64 at position n*dim + d + 1 of the stream */
+	  uint64 z = seed + (n*dim + d + 1)*0x9E3779B97F4A7C15ULL;
+	  z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ULL;
+	  z = (z ^ (z >> 27))*0x94D049BB133111EBULL;
+	  z ^= z >> 31;
+	  /* top 53 bits, centred: in (0,1) */
+	  column[b] = ((int64)(z >> 11) + 0.5)*(1.0/9007199254740992.0);
+	}
+      next[d] = n;
+    }
+}
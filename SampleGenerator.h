@@ -0,0 +1,194 @@
+/* Class SampleGenerator is the interface through which SobolIndices,
+ * SuperSobolIndices and SobolEngine draw their Unif(0,1) points, so
+ * the sampler is chosen at construction (SamplerType) instead of being
+ * wired into the estimators.  Points are generated in blocks,
+ * structure-of-arrays, and the sequence can be seeked to any point, so
+ * threads walking disjoint ranges of it with their own Clone() give
+ * the same points as one generator walking all of it.
+ *
+ * Implementations: the RASRAP Halton sequence (Halton.h), the
+ * scrambled Sobol' sequence (SobolSequence.h), a randomly shifted
+ * rank-1 lattice and plain Monte Carlo from a counter-based hash; the
+ * last two seek in O(1).
+ */
+
+#ifndef SAMPLEGENERATOR_H
+#define SAMPLEGENERATOR_H
+
+#include <vector>
+#include "Halton.h"
+#include "SobolSequence.h"
+
+typedef double Type;
+
+/* Samplers selectable at construction of the estimators */
+enum SamplerType
+{
+  SAMPLER_HALTON,  // random-start randomly permuted Halton
+  SAMPLER_SOBOL,  // linear-matrix scrambled Sobol'
+  SAMPLER_MONTE_CARLO,  // independent uniforms
+  SAMPLER_LATTICE  // randomly shifted rank-1 lattice
+};
+
+#define LATTICE_DIM 1000  /* coordinates with a generating vector entry */
+#define LATTICE_LOG2_N 20  /* the vector was built for up to 2^20 points */
+
+/* generating vector z_1..z_LATTICE_DIM, see LatticeVectors.cpp */
+extern const unsigned int lattice_vector[];
+
+class SampleGenerator
+{
+ public:
+  virtual ~SampleGenerator() {}
+
+  /* number of coordinates of a point */
+  virtual unsigned int GetDim() const = 0;
+
+  /* Generates the next B points of coordinates
+   * firstCoordinate..firstCoordinate+numCoordinates-1 (numbered from
+   * 1), coordinate d of point b going to
+   * out[(d - firstCoordinate)*stride + b].  The other coordinates do
+   * not move, so all must be advanced by the same B, e.g. the x1 and
+   * x2 halves of a sample block in two calls. */
+  virtual void Generate(unsigned int firstCoordinate,
+			unsigned int numCoordinates, unsigned int B,
+			Type *out, unsigned int stride) = 0;
+
+  /* As above for all coordinates */
+  void Generate(unsigned int B, Type *out, unsigned int stride)
+  {
+    Generate(1, GetDim(), B, out, stride);
+  }
+
+  /* Positions the sequence so that the next point generated is point
+   * n; Seek(0) is the start */
+  virtual void Seek(uint64 n) = 0;
+
+  /* A new generator of the same sequence (same random start,
+   * permutation, scramble or seed) with its own position, at Seek(0),
+   * for another thread; the caller deletes it */
+  virtual SampleGenerator* Clone() const = 0;
+
+  /* Returns a new generator of the given type for points of dim
+   * coordinates, randomized from the process-wide genRand_64 */
+  static SampleGenerator* New(SamplerType type, unsigned int dim);
+};
+
+class HaltonGenerator : public SampleGenerator
+{
+ private:
+  unsigned int dim;
+  halton *generator;
+
+  /* worker of master, see Clone() */
+  explicit HaltonGenerator(const halton &master, unsigned int dim_);
+  HaltonGenerator(const HaltonGenerator&);
+  HaltonGenerator& operator=(const HaltonGenerator&);
+
+ public:
+  /* random start, random permutation */
+  explicit HaltonGenerator(unsigned int dim_);
+  ~HaltonGenerator() {delete generator;}
+
+  unsigned int GetDim() const {return dim;}
+  void Generate(unsigned int firstCoordinate,
+		unsigned int numCoordinates, unsigned int B,
+		Type *out, unsigned int stride)
+  {
+    generator->genHaltonBlock(firstCoordinate, numCoordinates, B, out,
+			      stride);
+  }
+  void Seek(uint64 n) {generator->seek(n);}
+  SampleGenerator* Clone() const;
+};
+
+class SobolSequenceGenerator : public SampleGenerator
+{
+ private:
+  unsigned int dim;
+  sobol_sequence *generator;
+
+  /* worker of master, see Clone() */
+  explicit SobolSequenceGenerator(const sobol_sequence &master,
+				  unsigned int dim_);
+  SobolSequenceGenerator(const SobolSequenceGenerator&);
+  SobolSequenceGenerator& operator=(const SobolSequenceGenerator&);
+
+ public:
+  /* scrambled */
+  explicit SobolSequenceGenerator(unsigned int dim_);
+  ~SobolSequenceGenerator() {delete generator;}
+
+  unsigned int GetDim() const {return dim;}
+  void Generate(unsigned int firstCoordinate,
+		unsigned int numCoordinates, unsigned int B,
+		Type *out, unsigned int stride)
+  {
+    generator->genSobolBlock(firstCoordinate, numCoordinates, B, out,
+			     stride);
+  }
+  void Seek(uint64 n) {generator->seek(n);}
+  SampleGenerator* Clone() const;
+};
+
+/* Extensible rank-1 lattice in base 2 with a Cranley-Patterson random
+ * shift: coordinate d of point n is frac(phi(n) z_d + shift_d), phi
+ * the radical inverse in base 2, so the first 2^m points are the
+ * 2^m-point lattice rule of generating vector z, shifted, for every m.
+ * In 64-bit fixed point frac(phi(n) z_d) is the product of z_d & the
+ * bit reversal of n modulo 2^64, exact, so a coordinate costs one
+ * integer multiply-add and a conversion.
+ *
+ * The shifted points are folded by the baker's transform
+ * x -> 1 - |2x - 1|, which keeps them uniform and lets the rule reach
+ * its O(N^-2) rate on smooth models that are not periodic; unfolded,
+ * a lattice does no better than Halton on them. */
+class LatticeGenerator : public SampleGenerator
+{
+ private:
+  unsigned int dim;
+  std::vector<uint64> shift;  // in units of 2^-64
+  std::vector<uint64> next;  // next point of each coordinate
+  std::vector<uint64> reversed;  // bit reversals of a block's points
+
+ public:
+  /* shift drawn from the process-wide genRand_64 */
+  explicit LatticeGenerator(unsigned int dim_);
+  LatticeGenerator(unsigned int dim_, const std::vector<uint64> &shift_);
+
+  unsigned int GetDim() const {return dim;}
+  void Generate(unsigned int firstCoordinate,
+		unsigned int numCoordinates, unsigned int B,
+		Type *out, unsigned int stride);
+  void Seek(uint64 n) {next.assign(dim, n);}
+  SampleGenerator* Clone() const
+  {
+    return new LatticeGenerator(dim, shift);
+  }
+};
+
+/* Coordinate d of point n is a hash of (seed, n, d): the SplitMix64
+ * output at that position of its stream */
+class MonteCarloGenerator : public SampleGenerator
+{
+ private:
+  unsigned int dim;
+  uint64 seed;
+  std::vector<uint64> next;  // next point of each coordinate
+
+ public:
+  /* seed drawn from the process-wide genRand_64 */
+  explicit MonteCarloGenerator(unsigned int dim_);
+  MonteCarloGenerator(unsigned int dim_, uint64 seed_);
+
+  unsigned int GetDim() const {return dim;}
+  void Generate(unsigned int firstCoordinate,
+		unsigned int numCoordinates, unsigned int B,
+		Type *out, unsigned int stride);
+  void Seek(uint64 n) {next.assign(dim, n);}
+  SampleGenerator* Clone() const
+  {
+    return new MonteCarloGenerator(dim, seed);
+  }
+};
+#endif
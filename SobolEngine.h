@@ -0,0 +1,285 @@
+/* Class template SobolEngine computes the same Sobol' index estimates
+ * as class SobolIndices, specialized at compile time for one model and
+ * dimension.  The model is a callable type taking a
+ * std::array<Type, Dim> of parameters, so calls inline; the index set
+ * is a bitmask (bit j for parameter j+1), optionally a template
+ * argument; and the sample block is std::array storage inside the
+ * object.  Since the index set only decides whether a column of arg1
+ * comes from x1 or x2, the mixed points are never copied: the model
+ * reads the chosen columns in place.
+ *
+ * The parameters are normal, as in SobolIndices, drawn from a
+ * SampleGenerator (the randomized Halton sequence by default) or from
+ * a NormalSampleBank shared with other objects.  Unlike SobolIndices,
+ * the engine runs serially and sums each block in two passes over the
+ * block and merges the block moments into the running ones, which
+ * vectorizes; its estimates therefore agree with SobolIndices to
+ * rounding, not bitwise.
+ *
+ * A shared bank must hold at least N_MC samples.
+ *
+ * Model requirements:  Type operator()(const std::array<Type, Dim>&)
+ * (const or not), copy-constructible.
+ */
+
+#ifndef SOBOLENGINE_H
+#define SOBOLENGINE_H
+
+#include <array>
+#include <iostream>
+#include <type_traits>
+#include "SobolIndices.h"
+
+template <int Dim, class Model, unsigned int BlockSize = 256>
+class SobolEngine
+{
+  static_assert(Dim >= 1 && Dim <= 64,
+		"SobolEngine index sets are 64-bit masks");
+
+ public:
+  typedef std::array<Type, Dim> Point;
+
+ private:
+  Model model;  /* model functor */
+  unsigned int N_MC;  /* no. of MC runs to use */
+  Point means, variances;  /* normal distro params of model params */
+
+  /* Sobol indices */
+  Type lowerIndex, totalIndex, modelVariance, modelMean;
+
+  SampleGenerator *randomNumberGenerator;  /* 2*Dim-coordinate points */
+  InverseTransformation *invTrans; /* inverse transformation object */
+  /* if set, samples come from this bank instead of the generator */
+  std::shared_ptr<NormalSampleBank> sampleBank;
+
+  /* block of x1 & x2 points, column j holding parameter j+1 */
+  std::array<std::array<Type, BlockSize>, Dim> x1, x2;
+  /* model evaluations at x1, x2, arg1 & arg2 */
+  std::array<Type, BlockSize> f, f2, model1, model2;
+
+  /* Fills x1 & x2 with samples first..first+B-1 of the bank, or with
+   * the next B points of the generator */
+  void DrawBlock(unsigned int first, unsigned int B)
+  {
+    if (sampleBank)
+      {
+	const unsigned int bankStride = sampleBank->stride;
+	for (int j = 0; j < Dim; ++j)
+	  {
+	    Type sd = sqrt(variances[j]);
+	    const Type *z1 = sampleBank->z1.data() + j*bankStride + first;
+	    const Type *z2 = sampleBank->z2.data() + j*bankStride + first;
+	    for (unsigned int b = 0; b < B; ++b)
+	      {
+		x1[j][b] = means[j] + sd*z1[b];
+		x2[j][b] = means[j] + sd*z2[b];
+	      }
+	  }
+	return;
+      }
+
+    /* the rows of x1 & x2 are contiguous, BlockSize apart */
+    randomNumberGenerator->Generate(1, Dim, B, x1[0].data(), BlockSize);
+    randomNumberGenerator->Generate(Dim+1, Dim, B, x2[0].data(),
+				    BlockSize);
+    for (int j = 0; j < Dim; ++j)
+      {
+	Type sd = sqrt(variances[j]);
+	invTrans->Normal(x1[j].data(), B, means[j], sd, x1[j].data());
+	invTrans->Normal(x2[j].data(), B, means[j], sd, x2[j].data());
+      }
+  }
+
+  /* Evaluates the model at B points whose column j is columns[j] */
+  void Evaluate(const Type *const *columns, unsigned int B,
+		std::array<Type, BlockSize> &outputs)
+  {
+    Point p;
+    for (unsigned int b = 0; b < B; ++b)
+      {
+	for (int j = 0; j < Dim; ++j)
+	  {
+	    p[j] = columns[j][b];
+	  }
+	outputs[b] = model(p);
+      }
+  }
+
+  /* Mean & M2 of B values by two passes over the block, merged into
+   * the running moments (n, mean, M2).  Four partial sums break the
+   * add latency chain, so the passes run at load speed. */
+  static void MergeBlock(const Type *values, unsigned int B, uint64 n,
+			 Type &mean, Type &M2)
+  {
+    Type sum[4] = {0, 0, 0, 0};
+    unsigned int b = 0;
+    for (; b + 4 <= B; b += 4)
+      {
+	for (int l = 0; l < 4; ++l)
+	  {
+	    sum[l] += values[b + l];
+	  }
+      }
+    for (; b < B; ++b)
+      {
+	sum[0] += values[b];
+      }
+    Type blockMean = ((sum[0] + sum[1]) + (sum[2] + sum[3]))/B;
+
+    Type sq[4] = {0, 0, 0, 0};
+    for (b = 0; b + 4 <= B; b += 4)
+      {
+	for (int l = 0; l < 4; ++l)
+	  {
+	    Type d = values[b + l] - blockMean;
+	    sq[l] += d*d;
+	  }
+      }
+    for (; b < B; ++b)
+      {
+	Type d = values[b] - blockMean;
+	sq[0] += d*d;
+      }
+    Type blockM2 = (sq[0] + sq[1]) + (sq[2] + sq[3]);
+
+    WelfordMerge(n, mean, M2, B, blockMean, blockM2);
+  }
+
+  /* MC loop for index set mask, a uint64 or a
+   * std::integral_constant<uint64, ...> */
+  template <class Mask>
+  void Compute(Mask mask)
+  {
+    SobolAccumulator acc;
+    std::array<Type, BlockSize> Dy, DT;
+    const Type *arg1[Dim], *arg2[Dim], *col1[Dim], *col2[Dim];
+
+    /* arg1 = x1 on the index set & x2 off it, arg2 the reverse */
+    for (int j = 0; j < Dim; ++j)
+      {
+	bool inIndexSet = (mask >> j) & 1;
+	col1[j] = x1[j].data();
+	col2[j] = x2[j].data();
+	arg1[j] = inIndexSet ? col1[j] : col2[j];
+	arg2[j] = inIndexSet ? col2[j] : col1[j];
+      }
+
+    for (unsigned int i = 0; i < N_MC; i += BlockSize)
+      {
+	unsigned int B = std::min(BlockSize, N_MC - i);
+
+	DrawBlock(i, B);
+
+	Evaluate(col1, B, f);
+	Evaluate(col2, B, f2);
+	Evaluate(arg1, B, model1);
+	Evaluate(arg2, B, model2);
+
+	for (unsigned int b = 0; b < B; ++b)
+	  {
+	    Dy[b] = f[b]*(model1[b] - f2[b]);
+	    DT[b] = (f[b] - model2[b])*(f[b] - model2[b]);
+	  }
+
+	MergeBlock(f.data(), B, acc.n, acc.fMean[0], acc.fM2[0]);
+	MergeBlock(Dy.data(), B, acc.n, acc.DyMean[0], acc.DyM2[0]);
+	MergeBlock(DT.data(), B, acc.n, acc.DTMean[0], acc.DTM2[0]);
+	acc.n += B;
+      }
+
+    modelMean = acc.fMean[0];
+    modelVariance = acc.Variance(acc.fM2[0]);
+
+    /* non-normalized */
+    lowerIndex = acc.DyMean[0];
+    totalIndex = acc.DTMean[0]/2.0;
+  }
+
+ public:
+  /* Ctor
+   * Input:
+   *
+   * model_ = model functor, see top of file
+   * means_, variances_ = normal distro params of model params
+   * N_MC_ = number of Monte Carlo runs
+   * sampler = sequence to draw the points from
+   */
+  SobolEngine(const Model &model_, const Point &means_,
+	      const Point &variances_, unsigned int N_MC_,
+	      SamplerType sampler = SAMPLER_HALTON)
+    : model(model_), N_MC(N_MC_), means(means_), variances(variances_),
+    lowerIndex(0), totalIndex(0), modelVariance(0), modelMean(0)
+  {
+    randomNumberGenerator = SampleGenerator::New(sampler, 2*Dim);
+    invTrans = new InverseTransformation();
+  }
+
+  /* Computes the indices of the index set whose bit j is set if
+   * parameter j+1 is in it; returns totalIndex.  A mask with bits at
+   * or above Dim is reported on stderr and the indices are kept. */
+  Type ComputeSensitivityIndices(uint64 indexMask)
+  {
+    if (Dim < 64 && indexMask >> (Dim % 64))
+      {
+	std::cerr << "SobolEngine::ComputeSensitivityIndices: index mask "
+		  << "has bits beyond parameter " << Dim << "\n";
+	return totalIndex;
+      }
+    Compute(indexMask);
+    return totalIndex;
+  }
+
+  /* As above, with the index set fixed at compile time */
+  template <uint64 IndexMask>
+  Type ComputeSensitivityIndices()
+  {
+    static_assert(Dim == 64 || IndexMask >> (Dim % 64) == 0,
+		  "index mask has bits beyond parameter Dim");
+    Compute(std::integral_constant<uint64, IndexMask>());
+    return totalIndex;
+  }
+
+  /* Sets mask to the bitmask of a set of parameter indices numbered
+   * from 1.  An index outside 1..Dim, which has no bit, is reported on
+   * stderr and returns false with mask left as it was. */
+  static bool IndexMask(const std::set<int> &indices, uint64 &mask)
+  {
+    if (!indices.empty() && (*indices.begin() < 1
+			     || *indices.rbegin() > Dim))
+      {
+	std::cerr << "SobolEngine::IndexMask: index outside 1.." << Dim
+		  << "\n";
+	return false;
+      }
+    mask = 0;
+    for (std::set<int>::const_iterator it = indices.begin();
+	 it != indices.end(); ++it)
+      {
+	mask |= 1ULL << (*it - 1);
+      }
+    return true;
+  }
+
+  void SetSampleBank(const std::shared_ptr<NormalSampleBank> &bank)
+  {sampleBank = bank;}
+  void ClearSampleBank() {sampleBank.reset();}
+  void SetVariances(const Point &variances_) {variances = variances_;}
+  void SetInverseNormalMethod(InverseNormalMethod method)
+  {invTrans->SetInverseNormalMethod(method);}
+
+  Type GetLowerIndex() {return lowerIndex;}
+  Type GetTotalIndex() {return totalIndex;}
+  Type GetModelMean() {return modelMean;}
+  Type GetModelVariance() {return modelVariance;}
+
+  ~SobolEngine()
+    {
+      delete randomNumberGenerator;
+      delete invTrans;
+    }
+
+ private:
+  SobolEngine(const SobolEngine&);
+  SobolEngine& operator=(const SobolEngine&);
+};
+#endif
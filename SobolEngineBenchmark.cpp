@@ -0,0 +1,144 @@
+/* Times SobolEngine against SobolIndices on the linear model of
+ * SobolIndicesDriver.cpp, with samples drawn from the Halton generator
+ * and from a shared sample bank (which leaves only the model
+ * evaluations & MC sums to time), then the batch SobolIndices with
+ * each SamplerType.  Usage: ./a.out [N_MC] [repeats]
+ */
+
+#include "SobolEngine.h"
+#include <cstdlib>
+#include <ctime>
+
+/* Practice linear model, parameters.size() = 4 */
+Type LinearModel(const std::vector<Type> &parameters,
+		 const std::vector<Type> &constants)
+{
+  Type Y = 0;
+  Type c = 0.1;
+  for (int i = 0; i < 4; ++i)
+    {
+      Y += c*parameters[i];
+    }
+  return Y;
+}
+
+/* Batch version of the linear model */
+void LinearModelBatch(const Type *parameters, unsigned int B,
+		      unsigned int stride,
+		      const std::vector<Type> &constants,
+		      Type *outputs)
+{
+  Type c = 0.1;
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      outputs[b] = 0;
+    }
+  for (int i = 0; i < 4; ++i)
+    {
+      const Type *column = parameters + i*stride;
+      for (unsigned int b = 0; b < B; ++b)
+	{
+	  outputs[b] += c*column[b];
+	}
+    }
+}
+
+/* Functor version of the linear model, for SobolEngine */
+struct LinearModelFunctor
+{
+  Type operator()(const std::array<Type, 4> &parameters) const
+  {
+    Type Y = 0;
+    Type c = 0.1;
+    for (int i = 0; i < 4; ++i)
+      {
+	Y += c*parameters[i];
+      }
+    return Y;
+  }
+};
+
+/* Runs compute() repeats times, prints the time per sample & the
+ * last result */
+template <class F>
+void Time(const char *name, unsigned int N_MC, int repeats, F compute)
+{
+  Type result = 0;
+  clock_t tic = clock();
+  for (int r = 0; r < repeats; ++r)
+    {
+      result = compute();
+    }
+  Type toc = (Type)(clock() - tic) / CLOCKS_PER_SEC;
+
+  std::cout << name << ": " << 1e9*toc/((Type)N_MC*repeats)
+	    << " ns/sample, totalIndex " << result << "\n";
+}
+
+int main(int argc, char** argv)
+{
+  const int dim = 4;
+  unsigned int N_MC = argc > 1 ? atoi(argv[1]) : 100000;
+  int repeats = argc > 2 ? atoi(argv[2]) : 10;
+
+  std::vector<Type> constants = {};
+  std::set<int> indices = {1};
+  std::vector<std::vector<Type> > distroParams(dim, std::vector<Type>(2));
+  std::array<Type, dim> means, variances;
+  for (int j = 0; j < dim; ++j)
+    {
+      distroParams[j][0] = means[j] = 0;
+      distroParams[j][1] = variances[j] = (j+1)*(j+1);
+    }
+
+  SobolIndices sobol(LinearModel, constants, indices, distroParams,
+		     dim, N_MC);
+  SobolIndices sobolBatch(LinearModelBatch, constants, indices,
+			  distroParams, dim, N_MC);
+  SobolEngine<dim, LinearModelFunctor>
+    engine(LinearModelFunctor(), means, variances, N_MC);
+
+  uint64 mask;
+  if (!SobolEngine<dim, LinearModelFunctor>::IndexMask(indices, mask))
+    return 1;
+
+  std::cout.precision(12);
+  std::cout << "N_MC = " << N_MC << ", " << repeats << " repeats\n\n";
+  std::cout << "Halton points:\n";
+  Time("  SobolIndices, scalar model", N_MC, repeats,
+       [&]() {return sobol.ComputeSensitivityIndices();});
+  Time("  SobolIndices, batch model", N_MC, repeats,
+       [&]() {return sobolBatch.ComputeSensitivityIndices();});
+  Time("  SobolEngine", N_MC, repeats,
+       [&]() {return engine.ComputeSensitivityIndices(mask);});
+
+  /* same N(0,1) draws for all three */
+  sobol.GenerateSampleBank();
+  sobolBatch.SetSampleBank(sobol.GetSampleBank());
+  engine.SetSampleBank(sobol.GetSampleBank());
+
+  std::cout << "\nshared sample bank:\n";
+  Time("  SobolIndices, scalar model", N_MC, repeats,
+       [&]() {return sobol.ComputeSensitivityIndices();});
+  Time("  SobolIndices, batch model", N_MC, repeats,
+       [&]() {return sobolBatch.ComputeSensitivityIndices();});
+  Time("  SobolEngine", N_MC, repeats,
+       [&]() {return engine.ComputeSensitivityIndices(mask);});
+  Time("  SobolEngine, compile-time set", N_MC, repeats,
+       [&]() {return engine.ComputeSensitivityIndices<1>();});
+
+  /* the exact (non-normalized) total index of parameter 1 is
+   * 0.1^2*variances[0] = 0.01 */
+  const char *samplerNames[] = {"  Halton", "  Sobol'", "  Monte Carlo",
+				 "  lattice"};
+  const SamplerType samplers[] = {SAMPLER_HALTON, SAMPLER_SOBOL,
+				  SAMPLER_MONTE_CARLO, SAMPLER_LATTICE};
+  std::cout << "\nsamplers, SobolIndices, batch model:\n";
+  for (int s = 0; s < 4; ++s)
+    {
+      SobolIndices sampled(LinearModelBatch, constants, indices,
+			   distroParams, dim, N_MC, 256, 1.0, samplers[s]);
+      Time(samplerNames[s], N_MC, repeats,
+	   [&]() {return sampled.ComputeSensitivityIndices();});
+    }
+}
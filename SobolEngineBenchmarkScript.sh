@@ -0,0 +1,6 @@
+#!/bin/bash
+
+g++ -O3 -std=c++0x -pthread SobolIndices.cpp ParameterDistribution.cpp TabulatedInverseCDF.cpp SobolEngineBenchmark.cpp SampleGenerator.cpp LatticeVectors.cpp Halton.cpp SobolSequence.cpp SobolDirections.cpp MT64.cpp InverseTransformation.cpp MersenneTwister.cpp pdflib.cpp rnglib.cpp
+
+# ./a.out 100000 10
+# ./a.out 1000000 5
@@ -1,5 +1,30 @@
 #include "SobolIndices.h"
 #include <fstream>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <map>
+
+/* Allocates the block scratch for blockSize samples of a
+ * dim-parameter model.  Columns are padded to a multiple of 8 so each
+ * one starts on an aligned boundary. */
+void SampleBlock::Allocate(int dim, unsigned int blockSize,
+			   unsigned int numOutputs)
+{
+  stride = (blockSize + 7) & ~7u;
+  x1.resize(dim*stride);
+  x2.resize(dim*stride);
+  arg1.resize(dim*stride);
+  arg2.resize(dim*stride);
+  f.resize(numOutputs*stride);
+  f2.resize(numOutputs*stride);
+  model1.resize(numOutputs*stride);
+  model2.resize(numOutputs*stride);
+  z1.resize(dim*stride);
+  z2.resize(dim*stride);
+  point.resize(dim);
+  outputs.resize(numOutputs);
+}
 
 /* Ctor
  * Input:
@@ -13,6 +38,8 @@
  * N_MC_ = number of Monte Carlo runs
  * CoV_ = defaulted to 1.0 to construct object without specifying CoV,
  *   used for CoV script.
+ * sampler_ = sequence the Unif(0,1) points are drawn from, defaulted
+ *   to the RASRAP Halton sequence.
  */
 SobolIndices::
 SobolIndices(Type (*model_)(const std::vector<Type>&,
@@ -23,34 +50,364 @@ SobolIndices(Type (*model_)(const std::vector<Type>&,
 	     &initialDistroParams_,
 	     int dim_,
 	     unsigned int N_MC_,
-	     Type CoV_)
+	     Type CoV_,
+	     SamplerType sampler_)
 {
   model = model_;
+  batchModel = NULL;
+  vectorModel = NULL;
+  numOutputs = 1;
+  constants = constants_;
+  indices = indices_;
+  distroParams = initialDistroParams_;
+  dim = dim_;
+  N_MC = N_MC_;
+  blockSize = 64;
+  CoV = CoV_;
+  sampler = sampler_;
+
+  Initialize();
+}
+
+/* Ctor for a batch model.
+ * Input:
+ *
+ * batchModel_ = model evaluating a block of points at once, see
+ *   BatchModel in header for the layout.
+ * blockSize_ = max number of points passed to one batchModel_ call
+ * Remaining inputs are as for the scalar-model ctor.
+ */
+SobolIndices::
+SobolIndices(BatchModel batchModel_,
+	     const std::vector<Type> &constants_,
+	     const std::set<int> &indices_,
+	     const std::vector<std::vector<Type> >
+	     &initialDistroParams_,
+	     int dim_,
+	     unsigned int N_MC_,
+	     unsigned int blockSize_,
+	     Type CoV_,
+	     SamplerType sampler_)
+{
+  model = NULL;
+  batchModel = batchModel_;
+  vectorModel = NULL;
+  numOutputs = 1;
+  constants = constants_;
+  indices = indices_;
+  distroParams = initialDistroParams_;
+  dim = dim_;
+  N_MC = N_MC_;
+  blockSize = blockSize_ > 0 ? blockSize_ : 1;
+  CoV = CoV_;
+  sampler = sampler_;
+
+  Initialize();
+}
+
+/* Ctor for a vector-valued model.  One pass over the samples computes
+ * the indices of all numOutputs_ outputs; see GetOutputLowerIndices()
+ * etc.
+ * Input:
+ *
+ * vectorModel_ = model writing numOutputs_ outputs, see VectorModel
+ *   in header.
+ * numOutputs_ = number of model outputs K
+ * Remaining inputs are as for the scalar-model ctor.
+ */
+SobolIndices::
+SobolIndices(VectorModel vectorModel_,
+	     unsigned int numOutputs_,
+	     const std::vector<Type> &constants_,
+	     const std::set<int> &indices_,
+	     const std::vector<std::vector<Type> >
+	     &initialDistroParams_,
+	     int dim_,
+	     unsigned int N_MC_,
+	     Type CoV_,
+	     SamplerType sampler_)
+{
+  model = NULL;
+  batchModel = NULL;
+  vectorModel = vectorModel_;
+  numOutputs = numOutputs_ > 0 ? numOutputs_ : 1;
+  constants = constants_;
+  indices = indices_;
+  distroParams = initialDistroParams_;
+  dim = dim_;
+  N_MC = N_MC_;
+  blockSize = 64;
+  CoV = CoV_;
+  sampler = sampler_;
+
+  Initialize();
+}
+
+/* Ctor for a batch model of numOutputs_ outputs, written as K rows of
+ * the output block (see BatchModel in header).  Inputs are as for the
+ * batch-model ctor.
+ */
+SobolIndices::
+SobolIndices(BatchModel batchModel_,
+	     unsigned int numOutputs_,
+	     const std::vector<Type> &constants_,
+	     const std::set<int> &indices_,
+	     const std::vector<std::vector<Type> >
+	     &initialDistroParams_,
+	     int dim_,
+	     unsigned int N_MC_,
+	     unsigned int blockSize_,
+	     Type CoV_,
+	     SamplerType sampler_)
+{
+  model = NULL;
+  batchModel = batchModel_;
+  vectorModel = NULL;
+  numOutputs = numOutputs_ > 0 ? numOutputs_ : 1;
   constants = constants_;
   indices = indices_;
   distroParams = initialDistroParams_;
   dim = dim_;
   N_MC = N_MC_;
+  blockSize = blockSize_ > 0 ? blockSize_ : 1;
   CoV = CoV_;
+  sampler = sampler_;
+
+  Initialize();
+}
+
+/* Copy ctor.  The copy draws from the same randomized sequence as
+ * other, from other's current position, through a
+ * generator of its own, so copies can run in separate threads (e.g.
+ * the parallel Super Sobol loop).  The copy is in serial mode. */
+SobolIndices::SobolIndices(const SobolIndices &other)
+{
+  model = other.model;
+  batchModel = other.batchModel;
+  vectorModel = other.vectorModel;
+  numOutputs = other.numOutputs;
+  constants = other.constants;
+  indices = other.indices;
+  distroParams = other.distroParams;
+  transformPlan = other.transformPlan;
+  dim = other.dim;
+  N_MC = other.N_MC;
+  blockSize = other.blockSize;
+  CoV = other.CoV;
+
+  lowerIndex = other.lowerIndex;
+  totalIndex = other.totalIndex;
+  modelVariance = other.modelVariance;
+  modelMean = other.modelMean;
+  lowerIndices = other.lowerIndices;
+  totalIndices = other.totalIndices;
+  lowerIndexHalfWidth = other.lowerIndexHalfWidth;
+  totalIndexHalfWidth = other.totalIndexHalfWidth;
+  lowerIndexStdError = other.lowerIndexStdError;
+  totalIndexStdError = other.totalIndexStdError;
+  confidenceZ = other.confidenceZ;
+  samplesUsed = other.samplesUsed;
+  outputLowerIndices = other.outputLowerIndices;
+  outputTotalIndices = other.outputTotalIndices;
+  outputLowerHalfWidths = other.outputLowerHalfWidths;
+  outputTotalHalfWidths = other.outputTotalHalfWidths;
+  outputLowerStdErrors = other.outputLowerStdErrors;
+  outputTotalStdErrors = other.outputTotalStdErrors;
+  outputMeans = other.outputMeans;
+  outputVariances = other.outputVariances;
+
+  block.Allocate(dim, blockSize, numOutputs);
+  invTrans = new InverseTransformation(other.invTrans->
+				       GetInverseNormalMethod());
+
+  sampleOffset = other.sampleOffset;
+  sampler = other.sampler;
+  randomNumberGenerator = other.randomNumberGenerator->Clone();
+  randomNumberGenerator->Seek(sampleOffset);
 
+  numThreads = 0;
+  chunkSize = other.chunkSize;
+
+  sampleBank = other.sampleBank;
+  referenceDesign = other.referenceDesign;
+  effectiveSampleSize = other.effectiveSampleSize;
+}
+
+/* Work shared by the ctors once the members above are assigned */
+void SobolIndices::Initialize()
+{
   /* initialize SIs */
   lowerIndex = 0;
   totalIndex = 0;
   modelVariance = 0;
   modelMean = 0;
+  lowerIndexHalfWidth = 0;
+  totalIndexHalfWidth = 0;
+  lowerIndexStdError = 0;
+  totalIndexStdError = 0;
+  confidenceZ = 1.959963984540054;  /* 95% */
+  samplesUsed = 0;
+  outputLowerIndices.assign(numOutputs, 0);
+  outputTotalIndices.assign(numOutputs, 0);
+  outputLowerHalfWidths.assign(numOutputs, 0);
+  outputTotalHalfWidths.assign(numOutputs, 0);
+  outputLowerStdErrors.assign(numOutputs, 0);
+  outputTotalStdErrors.assign(numOutputs, 0);
+  outputMeans.assign(numOutputs, 0);
+  outputVariances.assign(numOutputs, 0);
 
-  /* allocate memory for model arg vectors */
-  x1.resize(dim);
-  x2.resize(dim);
-  arg1.resize(dim);
-  arg2.resize(dim);
+  /* allocate memory for model arg blocks */
+  block.Allocate(dim, blockSize, numOutputs);
 
-  /* construct halton (RASRAP) & InverseTransformation objects */
-  randomNumberGenerator = new halton();
+  /* normal params until SetDistributions() is called */
+  transformPlan.CompileNormal(distroParams);
+
+  /* construct generator of 2*dim-coordinate points (x1 & x2) &
+   * InverseTransformation objects */
+  randomNumberGenerator = SampleGenerator::New(sampler, 2*dim);
   invTrans = new InverseTransformation();
 
-  /* init RNG: length of Halton vector, random start, random permute */
-  randomNumberGenerator->init(2*dim,true,true);
+  sampleOffset = 0;
+
+  /* serial until SetNumThreads() is called */
+  numThreads = 0;
+  chunkSize = 4096;
+
+  effectiveSampleSize = 0;
+}
+
+/* Sets the confidence level (e.g. 0.95) of the intervals reported by
+ * GetLowerIndexHalfWidth() & GetTotalIndexHalfWidth() */
+void SobolIndices::SetConfidenceLevel(Type level)
+{
+  confidenceZ = InverseTransformation::
+    StandardNormal(INVERSE_NORMAL_AS241, 0.5 + level/2.0);
+}
+
+/* Selects the inverse normal CDF approximation of the transformation
+ * to the model domain & of GenerateSampleBank(), see
+ * InverseTransformation.h */
+void SobolIndices::SetInverseNormalMethod(InverseNormalMethod method)
+{
+  invTrans->SetInverseNormalMethod(method);
+}
+
+/* Sets the distribution of each model parameter, replacing the
+ * normal distros of distroParams, and compiles the transformation of
+ * the sample columns to them.  The uncertainties of the Super Sobol'
+ * & CoV computations replace the variance of the normal & lognormal
+ * params (of log x for the latter) and leave the others as set here;
+ * distroParams keeps {mean, variance} of those params, of log x for
+ * the lognormal.  EvaluateReferenceDesign() needs normal params.  A
+ * vector that is not of dim descriptors is reported on stderr and
+ * rejected, keeping the previous distros.
+ *
+ * Input:
+ *   distros = dim descriptors, see ParameterDistribution.h
+ *
+ * Output:
+ *   true if the distros were set
+ */
+bool SobolIndices::
+SetDistributions(const std::vector<ParameterDistribution> &distros)
+{
+  if (distros.size() != (size_t)dim)
+    {
+      std::cerr << "SobolIndices::SetDistributions: " << distros.size()
+		<< " distros for " << dim << " params\n";
+      return false;
+    }
+
+  for (int j = 0; j < dim; ++j)
+    {
+      if (distros[j].HasVariance())
+	{
+	  distroParams[j][0] = distros[j].p[0];
+	  distroParams[j][1] = distros[j].p[1];
+	}
+    }
+  transformPlan.Compile(distros);
+  return true;
+}
+
+/* Sets the correlation of the model params, given as that of their
+ * N(0,1) scores (the Nataf model; for normal params it is their own
+ * correlation).  The matrix is factored once, here, and each block of
+ * x1 & x2 is then correlated as N(0,1) numbers before the columns go
+ * to their distros, see TransformPlan::Correlate(); no sample
+ * allocates.  Each of x1 & x2 has the joint distro, and so do the
+ * mixed points of the estimators: one takes the params of the index
+ * set from x1 and draws the others given those, from the scores of x2
+ * (see TransformPlan::Mix()), the other takes the complement from x1.
+ * The lower index is then Var(E[f|x_u])/Var(f) and the total one
+ * E[Var(f|x_~u)]/Var(f) under the correlated distro, the indices for
+ * dependent inputs; with correlation, the lower index of a set can
+ * exceed its total one.  The single-param indices of
+ * ComputeAllSingletonIndices() cost 2*dim+2 evaluations per sample
+ * instead of dim+2.  The reweighted estimates of
+ * EvaluateReferenceDesign() need independent params.  A matrix that is
+ * not dim x dim, symmetric, with unit diagonal & positive definite is
+ * reported on stderr and rejected, keeping the previous correlation.
+ *
+ * Input:
+ *   correlation = dim x dim symmetric positive definite matrix with
+ *       unit diagonal, or empty for independent params
+ *
+ * Output:
+ *   true if the correlation was set
+ */
+bool SobolIndices::
+SetCorrelation(const std::vector<std::vector<Type> > &correlation)
+{
+  return transformPlan.SetCorrelation(correlation);
+}
+
+/* Switches the MC loop of ComputeSensitivityIndices() to threaded
+ * mode.  The N_MC samples are cut into chunks of chunkSize_ samples;
+ * the threads take chunks in turn, each drawing from its own clone
+ * of the generator positioned at the chunk's first point and summing into
+ * the chunk's own accumulator.  The chunk sums are then merged in
+ * chunk order, so the results are bitwise identical for any
+ * numThreads_ >= 1 with the same chunkSize_.  They differ from the
+ * serial mode (numThreads_ = 0) only in summation order.
+ *
+ * The model must be safe to call from several threads at once.
+ */
+void SobolIndices::
+SetNumThreads(unsigned int numThreads_, unsigned int chunkSize_)
+{
+  DeleteWorkers();
+
+  numThreads = numThreads_;
+  chunkSize = chunkSize_ > 0 ? chunkSize_ : 1;
+
+  for (unsigned int t = 0; t < numThreads; ++t)
+    {
+      workerRNGs.push_back(randomNumberGenerator->Clone());
+    }
+  workerBlocks.resize(numThreads);
+  for (unsigned int t = 0; t < numThreads; ++t)
+    {
+      workerBlocks[t].Allocate(dim, blockSize, numOutputs);
+    }
+}
+
+void SobolIndices::DeleteWorkers()
+{
+  for (size_t t = 0; t < workerRNGs.size(); ++t)
+    {
+      delete workerRNGs[t];
+    }
+  workerRNGs.clear();
+  workerBlocks.clear();
+}
+
+/* Moves to point number n of the sequence, so the next computation
+ * starts from there. */
+void SobolIndices::SetSampleOffset(uint64 n)
+{
+  sampleOffset = n;
+  randomNumberGenerator->Seek(sampleOffset);
 }
 
 /* Displays member variables of the SobolIndices class */
@@ -64,6 +421,19 @@ void SobolIndices::DisplayMembers()
   std::cout << "totalIndex: " << totalIndex << "\n";
   std::cout << "modelVariance: " << modelVariance << "\n";
   std::cout << "modelMean: " << modelMean << "\n";
+  if (numOutputs > 1)
+    {
+      std::cout << "outputLowerIndices, outputTotalIndices: \n";
+      DisplayVector(std::vector<std::vector<Type> >
+		    {outputLowerIndices, outputTotalIndices});
+    }
+  if (!totalIndices.empty())
+    {
+      std::cout << "lowerIndices: \n";
+      DisplayVector(lowerIndices);
+      std::cout << "totalIndices: \n";
+      DisplayVector(totalIndices);
+    }
   std::cout << "indices: \n";
   DisplaySet(indices);
   std::cout << "distroParams: \n";
@@ -86,6 +456,10 @@ void SobolIndices::DisplayMembers()
  * Overloading previous function to allow different indices than those
  * passed into ctor, as need in CoV routine.
  *
+ * The N_MC samples are generated, transformed and evaluated
+ * blockSize at a time; the accumulation is still done sample by
+ * sample in sequence order.
+ *
  * Input:
  *   uncertainties = vector of parameter variances to use
  *   indices - set of parameters to compute sensitivity index for,
@@ -97,242 +471,1715 @@ ComputeSensitivityIndices(const std::vector<Type> &uncertainties,
 {
   // std::cout << "Computing SIs, CoV \n";
 
+  /* look up index set membership once, not per sample */
+  std::vector<bool> inIndexSet;
+  IndexSetMembership(indices_, inIndexSet);
+
   /* MC accumulators */
-  Type f0_sum = 0, Dy_sum = 0, DT_sum = 0, D_sum = 0;
+  SobolAccumulator acc(numOutputs);
+  Accumulate(uncertainties, inIndexSet, acc);
 
-  /* model evaluations */
-  Type f, f2, model1, model2;
+  AssignIndices(acc);
 
-  for (unsigned int i = 0; i < N_MC; ++i)
-    {
-      /* generate 2*dim random numbers */
-      randomNumberGenerator->genHalton();
+  return totalIndex;
+
+}
+
+/* Like ComputeSensitivityIndices(), but stops drawing samples once
+ * the confidence intervals of both lowerIndex and totalIndex (of
+ * every model output) are narrower than tolerance (full width), or
+ * after N_MC samples.  The
+ * intervals are checked after every chunk of chunkSize samples (see
+ * SetNumThreads(), which also sets chunkSize in serial mode), once at
+ * least minSamples samples are in.  Chunks are summed separately and
+ * merged in order in both modes, so the stopping point and results do
+ * not depend on the thread count; threads may compute a few chunks
+ * past the stopping point, which are discarded.
+ *
+ * The intervals treat the samples as independent, which for
+ * quasi-random points is conservative: QMC errors are usually smaller.
+ *
+ * Input:
+ *   tolerance = interval width to reach
+ *   uncertainties = vector of parameter variances to use, defaulted
+ *                   to empty in header
+ *   indices_ = set of parameters to compute sensitivity index for,
+ *              defaulted to empty in header
+ *   minSamples = samples to draw before checking, defaulted to 1000
+ *                in header
+ */
+Type SobolIndices::
+ComputeSensitivityIndicesToPrecision(Type tolerance,
+				     const std::vector<Type> &uncertainties,
+				     const std::set<int> &indices_,
+				     unsigned int minSamples)
+{
+  std::vector<bool> inIndexSet;
+  IndexSetMembership(indices_, inIndexSet);
 
-      /* transform each random number to its distro. */
-      TransformToModelDomain(uncertainties);
+  unsigned int numChunks = (N_MC + chunkSize - 1)/chunkSize;
+  unsigned int round = numThreads > 0 ? numThreads : 1;
+  std::vector<SobolAccumulator> chunkAcc(round);
+  SobolAccumulator acc(numOutputs);
+  bool converged = false;
 
-      /* assign xformed random numbers to proper model arg vectors */
-      if (indices_.empty())
+  for (unsigned int c = 0; c < numChunks && !converged; c += round)
+    {
+      unsigned int end = std::min(c + round, numChunks);
+      std::fill(chunkAcc.begin(), chunkAcc.end(),
+		SobolAccumulator(numOutputs));
+
+      if (numThreads > 0)
 	{
-	  AssignModelArguments(indices);
+	  RunChunks([&](unsigned int t, unsigned int cc,
+			unsigned int first, unsigned int n)
+		    {
+		      PositionWorker(t, sampleOffset + first);
+		      AccumulateSamples(workerRNGs[t], workerBlocks[t],
+					first, n, uncertainties, inIndexSet,
+					chunkAcc[cc - c]);
+		    }, c, end);
 	}
       else
 	{
-	  AssignModelArguments(indices_);
+	  AccumulateSamples(randomNumberGenerator, block, c*chunkSize,
+			    std::min(chunkSize, N_MC - c*chunkSize),
+			    uncertainties, inIndexSet, chunkAcc[0]);
 	}
 
-      // DisplayVector(x1);
-      // DisplayVector(x2);
-      // DisplayVector(arg1);
-      // DisplayVector(arg2);
+      for (unsigned int cc = c; cc < end && !converged; ++cc)
+	{
+	  acc.Merge(chunkAcc[cc - c]);
+	  AssignIndices(acc);
+	  converged = samplesUsed >= minSamples;
+	  for (unsigned int k = 0; k < numOutputs; ++k)
+	    {
+	      converged = converged
+		&& 2.0*outputLowerHalfWidths[k] <= tolerance
+		&& 2.0*outputTotalHalfWidths[k] <= tolerance;
+	    }
+	}
+    }
 
-      /* MC accumulations */
-      f = model(x1,constants);
-      f2 = model(x2,constants);
-      model1 = model(arg1,constants);
-      model2 = model(arg2,constants);
+  if (!sampleBank)
+    {
+      if (numThreads > 0)
+	{
+	  SetSampleOffset(sampleOffset + samplesUsed);
+	}
+      else
+	{
+	  sampleOffset += samplesUsed;
+	}
+    }
 
-      // std::cout << "f = " << f << "\n";
-      // std::cout << "f2 = " << f2 << "\n";
-      // std::cout << "model1 = " << model1 << "\n";
-      // std::cout << "model2 = " << model2 << "\n";
+  return totalIndex;
+}
 
+/* Randomized QMC: computes the indices of indices_ on R independent
+ * randomizations of the sequence (R new generators of the sampler
+ * type, each starting at its first point) and reports the mean of
+ * the R estimates, with its standard error from their spread (see
+ * GetLowerIndexStdError() etc.).  Unlike the intervals of
+ * ComputeSensitivityIndices(), which treat the points as independent,
+ * this error estimate is valid for QMC points and reflects their
+ * faster convergence, so fewer samples are needed for a given
+ * precision.  R of 8 to 32 is usual.
+ *
+ * The replicates draw up to N_MC samples each.  With tolerance > 0
+ * they stop early, all at the same sample count, once the confidence
+ * intervals (full width) of lowerIndex and totalIndex of every output
+ * are within tolerance; they are checked every chunkSize samples (see
+ * SetNumThreads()) once at least minSamples samples are in across the
+ * replicates.  In threaded mode the replicates run in parallel, one
+ * per thread at a time; each is summed in sequence order, so the
+ * results do not depend on the thread count.
+ *
+ * The master generator does not move, and a sample bank, if set, is
+ * not used: the replicates need their own points.  samplesUsed counts
+ * the samples of all replicates.
+ *
+ * Input:
+ *   R = number of randomizations, at least 2
+ *   tolerance = interval width to reach, defaulted to 0 (draw N_MC
+ *               samples per replicate) in header
+ *   uncertainties = vector of parameter variances to use, defaulted
+ *                   to empty in header
+ *   indices_ = set of parameters to compute sensitivity index for,
+ *              defaulted to empty in header
+ *   minSamples = samples to draw before checking, defaulted to 1000
+ *                in header
+ */
+Type SobolIndices::
+ComputeReplicatedSensitivityIndices(unsigned int R, Type tolerance,
+				    const std::vector<Type> &uncertainties,
+				    const std::set<int> &indices_,
+				    unsigned int minSamples)
+{
+  std::vector<bool> inIndexSet;
+  IndexSetMembership(indices_, inIndexSet);
 
-      f0_sum += f;
-      D_sum += f*f;
-      Dy_sum += f*(model1 - f2);
-      DT_sum += pow((f - model2), 2.0);
+  R = std::max(R, 2u);
+  std::vector<SampleGenerator*> replicates(R);
+  for (unsigned int r = 0; r < R; ++r)
+    {
+      replicates[r] = SampleGenerator::New(sampler, 2*dim);
     }
+  std::vector<SobolAccumulator> replicateAcc(R,
+					     SobolAccumulator(numOutputs));
+
+  /* set aside the bank so DrawBlock() uses the replicates */
+  std::shared_ptr<NormalSampleBank> bank;
+  bank.swap(sampleBank);
 
-  /* compute sensitivity indices */
-  modelMean = f0_sum/N_MC;
-  modelVariance = D_sum/N_MC  - modelMean*modelMean;
+  unsigned int step = tolerance > 0 ? chunkSize : N_MC;
+  bool converged = false;
 
-  Type Dy = Dy_sum/N_MC;
-  Type DT = DT_sum/N_MC;
+  for (unsigned int first = 0; first < N_MC && !converged; first += step)
+    {
+      unsigned int n = std::min(step, N_MC - first);
 
-  // std::cout << "Dy = " << Dy << "\n";
-  // std::cout << "DT = " << DT << "\n";
+      if (numThreads > 0)
+	{
+	  RunTasks([&](unsigned int t, unsigned int r)
+		   {
+		     AccumulateSamples(replicates[r], workerBlocks[t],
+				       first, n, uncertainties, inIndexSet,
+				       replicateAcc[r]);
+		   }, 0, R);
+	}
+      else
+	{
+	  for (unsigned int r = 0; r < R; ++r)
+	    {
+	      AccumulateSamples(replicates[r], block, first, n,
+				uncertainties, inIndexSet, replicateAcc[r]);
+	    }
+	}
 
-  //  /* normalized */
-  // lowerIndex = Dy/modelVariance;
-  // totalIndex = DT/(2.0*modelVariance);
+      AssignReplicateIndices(replicateAcc);
+      converged = tolerance > 0 && samplesUsed >= minSamples;
+      for (unsigned int k = 0; k < numOutputs && converged; ++k)
+	{
+	  converged = 2.0*outputLowerHalfWidths[k] <= tolerance
+	    && 2.0*outputTotalHalfWidths[k] <= tolerance;
+	}
+    }
 
-  /* non-normalized */
-  lowerIndex = Dy;
-  totalIndex = DT/2.0;
+  sampleBank.swap(bank);
+  for (unsigned int r = 0; r < R; ++r)
+    {
+      delete replicates[r];
+    }
 
   return totalIndex;
-
 }
 
-/* Function AssignModelArguments fills the two vectors that will be 
- * passed to the model for evaluation in computing the Sobol' indices.
+/* Compiles a list of index sets into a plan for ComputeIndexSets():
+ * turns each set into bitmasks and finds the distinct mixed points
+ * the sets need, so the std::set lookups and the duplicate model
+ * evaluations are paid once, not per sample.  Plans can be reused for
+ * any number of computations.
+ *
+ * Input:
+ *   indexSets = index sets, parameters numbered from 1
+ *   dim_ = number of model parameters
+ *   plan = plan to fill
+ *
+ * Returns false, reported on stderr, if a set holds an index outside
+ * 1..dim_; plan is then left empty with dim 0, which
+ * ComputeIndexSets() rejects.
  */
-void SobolIndices::
-AssignModelArguments(const std::set<int>& indices_)
+bool SobolIndices::
+CompileIndexSets(const std::vector<std::set<int> > &indexSets, int dim_,
+		 IndexSetPlan &plan)
 {
-  for (int j = 1; j <= dim; ++j)
+  plan.dim = 0;
+  plan.sets.clear();
+  plan.masks.clear();
+  plan.arg1Point.clear();
+  plan.arg2Point.clear();
+  for (size_t k = 0; k < indexSets.size(); ++k)
+    {
+      if (!indexSets[k].empty() && (*indexSets[k].begin() < 1
+				    || *indexSets[k].rbegin() > dim_))
+	{
+	  std::cerr << "SobolIndices::CompileIndexSets: index set " << k
+		    << " holds a parameter outside 1.." << dim_ << "\n";
+	  return false;
+	}
+    }
+
+  const int numWords = (dim_ + 63)/64;
+  const std::vector<uint64> none(numWords, 0);
+  std::vector<uint64> all(numWords, ~0ULL);
+  if (dim_ % 64)
+    {
+      all[numWords-1] = (1ULL << (dim_ % 64)) - 1;
+    }
+
+  plan.dim = dim_;
+  plan.sets = indexSets;
+  plan.masks.clear();
+  plan.arg1Point.resize(indexSets.size());
+  plan.arg2Point.resize(indexSets.size());
+
+  std::map<std::vector<uint64>, int> pointOfMask;
+  auto point = [&](const std::vector<uint64> &mask)
     {
-      /* check if j is in the index set to compute SIs for */
-      bool inIndexSet = indices_.count(j);
+      if (mask == all)
+	return IndexSetPlan::PLAN_X1;
+      if (mask == none)
+	return IndexSetPlan::PLAN_X2;
+      std::map<std::vector<uint64>, int>::iterator it
+	= pointOfMask.find(mask);
+      if (it != pointOfMask.end())
+	return it->second;
+      int k = plan.masks.size();
+      plan.masks.push_back(mask);
+      pointOfMask[mask] = k;
+      return k;
+    };
 
-      if (inIndexSet)
+  for (size_t k = 0; k < indexSets.size(); ++k)
+    {
+      std::vector<uint64> mask(numWords, 0), complement(numWords);
+      for (std::set<int>::const_iterator it = indexSets[k].begin();
+	   it != indexSets[k].end(); ++it)
 	{
-	  arg1[j-1] = x1[j-1];
-	  arg2[j-1] = x2[j-1];
+	  mask[(*it - 1)/64] |= 1ULL << ((*it - 1) % 64);
 	}
-      else
+      for (int w = 0; w < numWords; ++w)
+	{
+	  complement[w] = all[w] & ~mask[w];
+	}
+
+      plan.arg1Point[k] = point(mask);
+      plan.arg2Point[k] = point(complement);
+    }
+  return true;
+}
+
+/* Returns the dim_*(dim_-1)/2 sets {i,j}, i < j.  Their lower indices
+ * from ComputeIndexSets() are the closed second-order indices; the
+ * second-order interaction of i & j is that minus the first-order
+ * indices of i and j. */
+std::vector<std::set<int> > SobolIndices::PairIndexSets(int dim_)
+{
+  std::vector<std::set<int> > pairs;
+  for (int i = 1; i <= dim_; ++i)
+    {
+      for (int j = i + 1; j <= dim_; ++j)
 	{
-	  arg1[j-1] = x2[j-1];
-	  arg2[j-1] = x1[j-1];
+	  std::set<int> pair;
+	  pair.insert(i);
+	  pair.insert(j);
+	  pairs.push_back(pair);
 	}
     }
+  return pairs;
 }
 
-/* Function TransformToModelDomain changes the elements of
- * x1 and x2 member vectors (the vectors passed to the model in
- * computation of the SIs) to fit in the model domain.  I.e., it takes
- * each arg vector, which is composed of Unif(0,1) random numbers, and
- * transforms each component to its respective distro.
+/* Computes the lower & total Sobol' indices of every set of a plan on
+ * one set of N_MC base samples.  Each sample evaluates f(x1), f(x2)
+ * and each distinct mixed point of the plan once, i.e.
+ * (2 + plan.masks.size())*N_MC model evaluations, against 4*N_MC per
+ * set for separate ComputeSensitivityIndices() calls.  Results go to
+ * setLowerIndices & setTotalIndices (element k for plan set k); the
+ * sample moments go to modelMean & modelVariance.  Runs threaded after
+ * SetNumThreads(), with results independent of the thread count.
  *
  * Input:
- *    (optional) uncertainties = vector of parameter uncertainties,
- *        defaulted to empty in header.  This is for use with Super
- *        Sobol index computation.
+ *   plan = index sets compiled by CompileIndexSets() for this object's
+ *          dim; a plan of another dim is reported on stderr and
+ *          nothing is computed
+ *   uncertainties = vector of parameter variances to use, defaulted
+ *                   to empty in header
  */
 void SobolIndices::
-TransformToModelDomain(const std::vector<Type> &uncertainties)
+ComputeIndexSets(const IndexSetPlan &plan,
+		 const std::vector<Type> &uncertainties)
 {
-  for (int j = 0; j < dim; ++j)
+  if (plan.dim != dim)
     {
-      /* get the RNs generated from ComputeSensitivityIndices fn */
-      x1[j] = randomNumberGenerator->get_rnd(j+1);
-      x2[j] = randomNumberGenerator->get_rnd(j+1+dim);
+      std::cerr << "SobolIndices::ComputeIndexSets: plan compiled for "
+		<< plan.dim << " parameters, not " << dim << "\n";
+      return;
+    }
 
-      // x1[j] = RNG->genrand64_real3();
-      // x2[j] = RNG->genrand64_real3();
+  const size_t numSets = plan.sets.size();
+  std::vector<SobolAccumulator> acc(numSets,
+				    SobolAccumulator(numOutputs));
 
-      /* true if "j" is in ORIGINAL index set */
-      bool inIndexSet = indices.count(j+1);
+  if (numThreads > 0)
+    {
+      unsigned int numChunks = (N_MC + chunkSize - 1)/chunkSize;
+      std::vector<SobolAccumulator>
+	chunkAcc(numChunks*numSets, SobolAccumulator(numOutputs));
 
-      Type mean = distroParams[j][0], var;
+      RunChunks([&](unsigned int t, unsigned int c,
+		    unsigned int first, unsigned int n)
+		{
+		  PositionWorker(t, sampleOffset + first);
+		  AccumulateIndexSetSamples(workerRNGs[t], workerBlocks[t],
+					    first, n, uncertainties, plan,
+					    &chunkAcc[c*numSets]);
+		});
 
-      /* If parameter uncertainty not changed, leave as initial. Ow
-       * change to new uncertainty. */
-      if (uncertainties.empty())
+      /* fixed merge order makes the sums independent of thread
+       * count */
+      for (unsigned int c = 0; c < numChunks; ++c)
 	{
-	  var = distroParams[j][1];
+	  for (size_t k = 0; k < numSets; ++k)
+	    {
+	      acc[k].Merge(chunkAcc[c*numSets + k]);
+	    }
 	}
-      else
+
+      if (!sampleBank)
 	{
-	  var = uncertainties[j];
+	  SetSampleOffset(sampleOffset + N_MC);
 	}
+    }
+  else
+    {
+      AccumulateIndexSetSamples(randomNumberGenerator, block, 0, N_MC,
+				uncertainties, plan, acc.data());
+      if (!sampleBank)
+	{
+	  sampleOffset += N_MC;
+	}
+    }
+
+  setLowerIndices.resize(numSets*numOutputs);
+  setTotalIndices.resize(numSets*numOutputs);
+  for (size_t k = 0; k < numSets; ++k)
+    {
+      AssignIndices(acc[k]);
+      std::copy(outputLowerIndices.begin(), outputLowerIndices.end(),
+		setLowerIndices.begin() + k*numOutputs);
+      std::copy(outputTotalIndices.begin(), outputTotalIndices.end(),
+		setTotalIndices.begin() + k*numOutputs);
+    }
+}
+
+/* Compiles indexSets (see CompileIndexSets()) and computes their
+ * indices with ComputeIndexSets(plan, uncertainties). */
+void SobolIndices::
+ComputeIndexSets(const std::vector<std::set<int> > &indexSets,
+		 const std::vector<Type> &uncertainties)
+{
+  IndexSetPlan plan;
+  if (CompileIndexSets(indexSets, dim, plan))
+    {
+      ComputeIndexSets(plan, uncertainties);
+    }
+}
+
+/* Draws n samples, numbered from first within this computation, and
+ * adds the estimator terms of every set of plan to acc[0..] (one
+ * accumulator per set).
+ */
+void SobolIndices::
+AccumulateIndexSetSamples(SampleGenerator *generator, SampleBlock &blk,
+			  unsigned int first, unsigned int n,
+			  const std::vector<Type> &uncertainties,
+			  const IndexSetPlan &plan,
+			  SobolAccumulator *acc)
+{
+  const unsigned int stride = blk.stride;
+  const unsigned int rows = numOutputs*stride;  /* one evaluation */
+  const size_t numMasks = plan.masks.size();
 
-      /* change variance of parameter of interest by CoV.
-       // * Also need to check the the index set being passed in is the
-       // * one of the original index set, since also passing in the
-       // * complement of that set for CoV.  Don't want to change the
-       // * CoV of those.
-       */
-      // if (inIndexSet)
-      // 	{
-      // 	  var = pow(distroParams[j][0]*CoV, 2.0);
-      // 	}
+  blk.mixed.resize(numMasks*rows);
 
-      x1[j] = invTrans->Normal(x1[j], mean, var);
-      x2[j] = invTrans->Normal(x2[j], mean, var);
+  /* with correlation, each mixed point draws its x2 params given
+   * the x1 ones */
+  std::vector<TransformPlan::Conditional> conds;
+  if (transformPlan.IsCorrelated())
+    {
+      std::vector<bool> fromX1(dim);
+      for (size_t m = 0; m < numMasks; ++m)
+	{
+	  for (int j = 0; j < dim; ++j)
+	    {
+	      fromX1[j] = (plan.masks[m][j/64] >> (j % 64)) & 1;
+	    }
+	  conds.push_back(transformPlan.Condition(fromX1));
+	}
     }
 
-  // /* For Vasicek, drew log a, log b, log sigma, so convert back to
-  //  * original params a,b,sigma */
-  // x1[0] = exp(x1[0]);  // convert log a -> a
-  // x2[0] = exp(x2[0]);  // convert log a -> a
-  // x1[1] = exp(x1[1]);  // convert log b -> b
-  // x2[1] = exp(x2[1]);  // convert log b -> b
-  // x1[2] = exp(x1[2]);  // convert log sigma -> sigma
-  // x2[2] = exp(x2[2]);  // convert log sigma -> sigma
+  for (unsigned int i = 0; i < n; i += blockSize)
+    {
+      unsigned int B = std::min(blockSize, n - i);
+
+      DrawBlock(generator, blk, first + i, B, uncertainties);
+
+      EvaluateModel(blk, blk.x1, B, blk.f);
+      EvaluateModel(blk, blk.x2, B, blk.f2);
+
+      /* build each distinct mixed point in arg1 & evaluate it */
+      for (size_t m = 0; m < numMasks; ++m)
+	{
+	  const std::vector<uint64> &mask = plan.masks[m];
+	  if (!conds.empty())
+	    {
+	      MixToModelDomain(blk, conds[m], blk.arg1, B, uncertainties);
+	    }
+	  else
+	    {
+	      for (int j = 0; j < dim; ++j)
+		{
+		  const AlignedBuffer<Type> &from
+		    = (mask[j/64] >> (j % 64)) & 1 ? blk.x1 : blk.x2;
+		  std::copy(from.data() + j*stride,
+			    from.data() + j*stride + B,
+			    blk.arg1.data() + j*stride);
+		}
+	    }
+	  EvaluateModel(blk, blk.arg1, B, blk.model1);
+	  std::copy(blk.model1.data(), blk.model1.data() + rows,
+		    blk.mixed.data() + m*rows);
+	}
+
+      for (size_t k = 0; k < plan.sets.size(); ++k)
+	{
+	  const Type *model1 = plan.arg1Point[k] >= 0 ?
+	    blk.mixed.data() + plan.arg1Point[k]*rows :
+	    plan.arg1Point[k] == IndexSetPlan::PLAN_X1 ?
+	    blk.f.data() : blk.f2.data();
+	  const Type *model2 = plan.arg2Point[k] >= 0 ?
+	    blk.mixed.data() + plan.arg2Point[k]*rows :
+	    plan.arg2Point[k] == IndexSetPlan::PLAN_X1 ?
+	    blk.f.data() : blk.f2.data();
+
+	  acc[k].Add(blk.f.data(), blk.f2.data(), stride,
+		     model1, model2, stride, B);
+	}
+    }
 }
 
-/* Computes the indices for the range of CoVs in the CoV_ vector.
- * The resulting indices are stored in a 2D vector:
- *     first row = total index of origianl set,
- *     second row = lower index of complement set,
- *     third row = model variance.
- * These indices are written to a file for plotting.
+/* Draws N_MC samples for a run whose base outputs f(x1) and f(x2) are
+ * reused by several index sets: evaluates and stores them in run, and
+ * records where the samples start.  Each
+ * ComputeSensitivityIndices(run, indices_) then regenerates the same
+ * samples and only evaluates the mixed points arg1 & arg2, i.e.
+ * 2*N_MC model evaluations per index set instead of 4*N_MC.  Consumes
+ * N_MC points of the sequence, as one computation does.
  *
  * Input:
- *     CoV_Vector = vector of CoVs to use in plotting
- *     filename = name of file for plotting
+ *   run = run context to fill
+ *   uncertainties = vector of parameter variances to use, defaulted
+ *                   to empty in header
  */
-std::vector<std::vector<Type> > SobolIndices::
-PlotCoV(const std::vector<Type> &CoV_Vector,
-	std::string &filename)
+void SobolIndices::
+BeginRun(SobolRunContext &run, const std::vector<Type> &uncertainties)
 {
-  std::cout << "PlotCoV \n";
+  run.N = N_MC;
+  run.sampleOffset = sampleOffset;
+  run.sampleBank = sampleBank;
+  run.uncertainties = uncertainties;
+  run.f.resize(numOutputs*N_MC);
+  run.f2.resize(numOutputs*N_MC);
+
+  /* evaluates f(x1) & f(x2) of samples first..first+n-1 */
+  auto evaluate = [&](SampleGenerator *generator, SampleBlock &blk,
+		      unsigned int first, unsigned int n)
+    {
+      for (unsigned int i = 0; i < n; i += blockSize)
+	{
+	  unsigned int B = std::min(blockSize, n - i);
+	  DrawBlock(generator, blk, first + i, B, uncertainties);
+	  EvaluateModel(blk, blk.x1, B, blk.f);
+	  EvaluateModel(blk, blk.x2, B, blk.f2);
+	  for (unsigned int k = 0; k < numOutputs; ++k)
+	    {
+	      const Type *f = blk.f.data() + k*blk.stride;
+	      const Type *f2 = blk.f2.data() + k*blk.stride;
+	      std::copy(f, f + B, &run.f[k*N_MC + first + i]);
+	      std::copy(f2, f2 + B, &run.f2[k*N_MC + first + i]);
+	    }
+	}
+    };
+
+  if (numThreads > 0)
+    {
+      RunChunks([&](unsigned int t, unsigned int,
+		    unsigned int first, unsigned int n)
+		{
+		  PositionWorker(t, sampleOffset + first);
+		  evaluate(workerRNGs[t], workerBlocks[t], first, n);
+		});
+      if (!sampleBank)
+	{
+	  SetSampleOffset(sampleOffset + N_MC);
+	}
+    }
+  else
+    {
+      evaluate(randomNumberGenerator, block, 0, N_MC);
+      if (!sampleBank)
+	{
+	  sampleOffset += N_MC;
+	}
+    }
+}
+
+/* Computes the Sobol' indices of indices_ on the samples of a run
+ * started with BeginRun(), reusing its f(x1) & f(x2).  Assigns the
+ * same members as the other overload and gives the same result as it
+ * would on those samples.  Does not move the generator.  A run no
+ * longer matching the samples (drawn with another sample bank or
+ * none, at another N_MC, or past the current point of the sequence)
+ * is reported on stderr and the indices are left as they were.
+ *
+ * Input:
+ *   run = run context filled by BeginRun()
+ *   indices_ = set of parameters to compute sensitivity index for,
+ *              defaulted to empty (the ctor's set) in header
+ */
+Type SobolIndices::
+ComputeSensitivityIndices(const SobolRunContext &run,
+			  const std::set<int> &indices_)
+{
+  if (run.N != N_MC || run.f.size() != numOutputs*N_MC
+      || run.sampleBank != sampleBank
+      || (!sampleBank && run.sampleOffset + run.N > sampleOffset))
+    {
+      std::cerr << "SobolIndices::ComputeSensitivityIndices: the run "
+		<< "context does not match the current samples\n";
+      return totalIndex;
+    }
+
+  std::vector<bool> inIndexSet;
+  IndexSetMembership(indices_, inIndexSet);
+
+  SobolAccumulator acc(numOutputs);
+  Accumulate(run.uncertainties, inIndexSet, acc, &run);
+
+  AssignIndices(acc);
+
+  return totalIndex;
+}
+
+/* inIndexSet[j] = true if parameter j+1 is in indices_, or in the
+ * ctor's index set if indices_ is empty */
+void SobolIndices::
+IndexSetMembership(const std::set<int> &indices_,
+		   std::vector<bool> &inIndexSet)
+{
+  const std::set<int> &indexSet = indices_.empty() ? indices : indices_;
+  inIndexSet.resize(dim);
+  for (int j = 0; j < dim; ++j)
+    {
+      inIndexSet[j] = indexSet.count(j+1);
+    }
+}
+
+/* Sets the index members & their confidence intervals from the
+ * estimator moments of the samples drawn, for every model output; the
+ * scalar members get output 0 */
+void SobolIndices::AssignIndices(const SobolAccumulator &acc)
+{
+  samplesUsed = acc.n;
+
+  for (unsigned int k = 0; k < numOutputs; ++k)
+    {
+      /* compute sensitivity indices */
+      outputMeans[k] = acc.fMean[k];
+      outputVariances[k] = acc.Variance(acc.fM2[k]);
+
+      Type Dy = acc.DyMean[k];
+      Type DT = acc.DTMean[k];
+
+      //  /* normalized */
+      // lowerIndex = Dy/modelVariance;
+      // totalIndex = DT/(2.0*modelVariance);
+
+      /* non-normalized */
+      outputLowerIndices[k] = Dy;
+      outputTotalIndices[k] = DT/2.0;
+
+      outputLowerStdErrors[k] = sqrt(acc.MeanVariance(acc.DyM2[k]));
+      outputTotalStdErrors[k] = sqrt(acc.MeanVariance(acc.DTM2[k]))/2.0;
+      outputLowerHalfWidths[k] = confidenceZ*outputLowerStdErrors[k];
+      outputTotalHalfWidths[k] = confidenceZ*outputTotalStdErrors[k];
+    }
+
+  modelMean = outputMeans[0];
+  modelVariance = outputVariances[0];
+  lowerIndex = outputLowerIndices[0];
+  totalIndex = outputTotalIndices[0];
+  lowerIndexHalfWidth = outputLowerHalfWidths[0];
+  totalIndexHalfWidth = outputTotalHalfWidths[0];
+  lowerIndexStdError = outputLowerStdErrors[0];
+  totalIndexStdError = outputTotalStdErrors[0];
+}
+
+/* Quantile of Student's t distribution with nu degrees of freedom at
+ * the level of the normal quantile z, by the Cornish-Fisher expansion
+ * (Abramowitz & Stegun 26.7.5); within 0.1% for nu >= 3 at the usual
+ * levels */
+static Type StudentQuantile(Type z, Type nu)
+{
+  Type z2 = z*z;
+  Type g1 = (z2 + 1)*z/4;
+  Type g2 = ((5*z2 + 16)*z2 + 3)*z/96;
+  Type g3 = (((3*z2 + 19)*z2 + 17)*z2 - 15)*z/384;
+  Type g4 = ((((79*z2 + 776)*z2 + 1482)*z2 - 1920)*z2 - 945)*z/92160;
+  return z + (g1 + (g2 + (g3 + g4/nu)/nu)/nu)/nu;
+}
+
+/* Sets the index members from the estimator moments of R independent
+ * randomizations of the sequence: each index is the mean of the R
+ * replicate estimates, its standard error their standard deviation
+ * over sqrt(R), and its half width the standard error times the
+ * Student t quantile of R - 1 degrees of freedom.  modelMean &
+ * modelVariance are replicate means too. */
+void SobolIndices::
+AssignReplicateIndices(const std::vector<SobolAccumulator> &replicateAcc)
+{
+  const unsigned int R = replicateAcc.size();
+  Type t = StudentQuantile(confidenceZ, R - 1);
+
+  samplesUsed = 0;
+  for (unsigned int r = 0; r < R; ++r)
+    {
+      samplesUsed += replicateAcc[r].n;
+    }
+
+  for (unsigned int k = 0; k < numOutputs; ++k)
+    {
+      Type fMean = 0, fVariance = 0, unused = 0;
+      Type lower = 0, lowerM2 = 0, total = 0, totalM2 = 0;
+      for (unsigned int r = 0; r < R; ++r)
+	{
+	  const SobolAccumulator &acc = replicateAcc[r];
+	  WelfordAdd(acc.fMean[k], r + 1, fMean, unused);
+	  WelfordAdd(acc.Variance(acc.fM2[k]), r + 1, fVariance, unused);
+	  WelfordAdd(acc.DyMean[k], r + 1, lower, lowerM2);
+	  WelfordAdd(acc.DTMean[k]/2.0, r + 1, total, totalM2);
+	}
+
+      outputMeans[k] = fMean;
+      outputVariances[k] = fVariance;
+      outputLowerIndices[k] = lower;
+      outputTotalIndices[k] = total;
+      outputLowerStdErrors[k] = sqrt(lowerM2/((Type)R*(R - 1)));
+      outputTotalStdErrors[k] = sqrt(totalM2/((Type)R*(R - 1)));
+      outputLowerHalfWidths[k] = t*outputLowerStdErrors[k];
+      outputTotalHalfWidths[k] = t*outputTotalStdErrors[k];
+    }
+
+  modelMean = outputMeans[0];
+  modelVariance = outputVariances[0];
+  lowerIndex = outputLowerIndices[0];
+  totalIndex = outputTotalIndices[0];
+  lowerIndexHalfWidth = outputLowerHalfWidths[0];
+  totalIndexHalfWidth = outputTotalHalfWidths[0];
+  lowerIndexStdError = outputLowerStdErrors[0];
+  totalIndexStdError = outputTotalStdErrors[0];
+}
+
+/* MC loop of a computation: sums the estimator terms of N_MC samples
+ * into acc, serially or in chunks (see SetNumThreads()).  Without a
+ * run context or sample bank the samples are the next N_MC points of
+ * the sequence and the master generator is left after them; with a
+ * run context they are the run's samples and the generator does not
+ * move.
+ */
+void SobolIndices::
+Accumulate(const std::vector<Type> &uncertainties,
+	   const std::vector<bool> &inIndexSet,
+	   SobolAccumulator &acc,
+	   const SobolRunContext *run)
+{
+  uint64 start = run ? run->sampleOffset : sampleOffset;
+
+  if (numThreads > 0)
+    {
+      unsigned int numChunks = (N_MC + chunkSize - 1)/chunkSize;
+      std::vector<SobolAccumulator> chunkAcc(numChunks,
+					     SobolAccumulator(numOutputs));
+
+      RunChunks([&](unsigned int t, unsigned int c,
+		    unsigned int first, unsigned int n)
+		{
+		  PositionWorker(t, start + first);
+		  AccumulateSamples(workerRNGs[t], workerBlocks[t], first, n,
+				    uncertainties, inIndexSet, chunkAcc[c],
+				    run);
+		});
+
+      /* fixed merge order makes the sums independent of thread
+       * count */
+      for (unsigned int c = 0; c < numChunks; ++c)
+	{
+	  acc.Merge(chunkAcc[c]);
+	}
+
+      if (!sampleBank && !run)
+	{
+	  SetSampleOffset(sampleOffset + N_MC);
+	}
+      return;
+    }
+
+  if (run && !sampleBank)
+    {
+      randomNumberGenerator->Seek(start);
+    }
+
+  AccumulateSamples(randomNumberGenerator, block, 0, N_MC,
+		    uncertainties, inIndexSet, acc, run);
+
+  if (sampleBank)
+    return;
+  if (run)
+    {
+      /* back to where the sequence was */
+      randomNumberGenerator->Seek(sampleOffset);
+    }
+  else
+    {
+      sampleOffset += N_MC;
+    }
+}
+
+/* Fills x1 & x2 of blk with the model-domain values of B samples:
+ * samples first..first+B-1 of the sample bank if one is set, else the
+ * next B points of generator. */
+void SobolIndices::
+DrawBlock(SampleGenerator *generator, SampleBlock &blk, unsigned int first,
+	  unsigned int B, const std::vector<Type> &uncertainties)
+{
+  if (sampleBank)
+    {
+      TransformBankToModelDomain(blk, first, B, uncertainties);
+    }
+  else
+    {
+      TransformToModelDomain(generator, blk, B, uncertainties);
+    }
+}
+
+/* Draws n samples, numbered from first within this computation, and
+ * adds their estimator terms to acc, working blockSize samples at a
+ * time.  Without a sample bank the samples are the next n points of
+ * generator.  With a run context, f(x1) & f(x2) are taken from it
+ * instead of being evaluated.
+ */
+void SobolIndices::
+AccumulateSamples(SampleGenerator *generator, SampleBlock &blk,
+		  unsigned int first, unsigned int n,
+		  const std::vector<Type> &uncertainties,
+		  const std::vector<bool> &inIndexSet,
+		  SobolAccumulator &acc,
+		  const SobolRunContext *run)
+{
+  /* with correlation, arg1 draws the complement given x1_u & arg2 the
+   * set given x1_~u */
+  const bool correlated = transformPlan.IsCorrelated();
+  TransformPlan::Conditional cond1, cond2;
+  if (correlated)
+    {
+      std::vector<bool> complement(dim);
+      for (int j = 0; j < dim; ++j)
+	{
+	  complement[j] = !inIndexSet[j];
+	}
+      cond1 = transformPlan.Condition(inIndexSet);
+      cond2 = transformPlan.Condition(complement);
+    }
+
+  for (unsigned int i = 0; i < n; i += blockSize)
+    {
+      unsigned int B = std::min(blockSize, n - i);
+
+      /* generate B points of 2*dim random numbers & transform each
+       * random number to its distro. */
+      DrawBlock(generator, blk, first + i, B, uncertainties);
+
+      /* assign xformed random numbers to proper model arg blocks */
+      if (correlated)
+	{
+	  MixToModelDomain(blk, cond1, blk.arg1, B, uncertainties);
+	  MixToModelDomain(blk, cond2, blk.arg2, B, uncertainties);
+	}
+      else
+	{
+	  AssignModelArguments(blk, inIndexSet, B);
+	}
+
+      const Type *f = blk.f.data(), *f2 = blk.f2.data();
+      unsigned int fStride = blk.stride;
+      if (run)
+	{
+	  f = run->f.data() + first + i;
+	  f2 = run->f2.data() + first + i;
+	  fStride = run->N;
+	}
+      else
+	{
+	  EvaluateModel(blk, blk.x1, B, blk.f);
+	  EvaluateModel(blk, blk.x2, B, blk.f2);
+	}
+      EvaluateModel(blk, blk.arg1, B, blk.model1);
+      EvaluateModel(blk, blk.arg2, B, blk.model2);
+
+      /* MC accumulations */
+      acc.Add(f, f2, fStride, blk.model1.data(), blk.model2.data(),
+	      blk.stride, B);
+    }
+}
+
+/* Runs tasks firstTask..endTask-1 on numThreads threads: each thread
+ * takes the next unclaimed task until none are left and calls
+ * work(t, task), t being the thread's number (index of its generator
+ * & block). */
+void SobolIndices::
+RunTasks(const std::function<void(unsigned int t,
+				  unsigned int task)> &work,
+	 unsigned int firstTask, unsigned int endTask)
+{
+  std::atomic<unsigned int> nextTask(firstTask);
+
+  auto loop = [&](unsigned int t)
+    {
+      unsigned int task;
+      while ((task = nextTask++) < endTask)
+	{
+	  work(t, task);
+	}
+    };
+
+  unsigned int T = std::min(numThreads, endTask - firstTask);
+  std::vector<std::thread> threads;
+  for (unsigned int t = 1; t < T; ++t)
+    {
+      threads.push_back(std::thread(loop, t));
+    }
+  loop(0);
+  for (size_t t = 0; t < threads.size(); ++t)
+    {
+      threads[t].join();
+    }
+}
+
+/* Threaded loop over the N_MC samples of a computation, see
+ * SetNumThreads().  The samples are cut into chunks of chunkSize; each
+ * thread takes the next unclaimed chunk c until none are left and
+ * calls work(t, c, first, n) for its samples first..first+n-1, t
+ * being the thread's number (index of its generator & block).  Only
+ * chunks firstChunk..endChunk-1 are run if given.
+ */
+void SobolIndices::
+RunChunks(const std::function<void(unsigned int t, unsigned int c,
+				   unsigned int first,
+				   unsigned int n)> &work,
+	  unsigned int firstChunk, unsigned int endChunk)
+{
+  unsigned int numChunks = std::min((N_MC + chunkSize - 1)/chunkSize,
+				    endChunk);
+  RunTasks([&](unsigned int t, unsigned int c)
+	   {
+	     unsigned int first = c*chunkSize;
+	     work(t, c, first, std::min(chunkSize, N_MC - first));
+	   }, firstChunk, numChunks);
+}
+
+/* Seeks thread t's generator to point n of the sequence; nothing to do
+ * when samples come from the sample bank */
+void SobolIndices::PositionWorker(unsigned int t, uint64 n)
+{
+  if (!sampleBank)
+    {
+      workerRNGs[t]->Seek(n);
+    }
+}
+
+/* Draws the next N_MC points of the sequence and stores them as
+ * standard-normal numbers.  Until ClearSampleBank() is called, every
+ * computation reuses these points (common random numbers), scaling
+ * and shifting them to the current means & variances instead of
+ * generating and inverse-transforming new ones.  The bank is replaced
+ * if one is already set.
+ */
+void SobolIndices::GenerateSampleBank()
+{
+  /* reuse the buffers if no copy of this object shares them */
+  if (!sampleBank || !sampleBank.unique() || sampleBank->N != N_MC)
+    {
+      sampleBank = std::make_shared<NormalSampleBank>();
+      sampleBank->N = N_MC;
+      sampleBank->stride = (N_MC + 7) & ~7u;
+      sampleBank->z1.resize(dim*sampleBank->stride);
+      sampleBank->z2.resize(dim*sampleBank->stride);
+    }
+
+  const unsigned int stride = sampleBank->stride;
+  Type *z1 = sampleBank->z1.data();
+  Type *z2 = sampleBank->z2.data();
+
+  /* coordinates 1..dim go to z1, dim+1..2*dim to z2 */
+  randomNumberGenerator->Generate(1, dim, N_MC, z1, stride);
+  randomNumberGenerator->Generate(dim+1, dim, N_MC, z2, stride);
+  sampleOffset += N_MC;
+
+  for (int j = 0; j < dim; ++j)
+    {
+      invTrans->Normal(z1 + j*stride, N_MC, 0, 1, z1 + j*stride);
+      invTrans->Normal(z2 + j*stride, N_MC, 0, 1, z2 + j*stride);
+    }
+}
+
+/* Evaluates the model once on a reference design: N_MC samples drawn
+ * with the given variances (from the generator, or the sample bank if
+ * one is set), for the index set passed to the ctor.  The outputs and
+ * the squared deviations of the samples from the means are kept for
+ * ComputeReweightedSensitivityIndices().  Copies of this object made
+ * afterwards share the design.  The likelihood ratios are those of
+ * normal params, so with other distros (see SetDistributions()) the
+ * call is reported on stderr and the design is left as it was.
+ *
+ * Input:
+ *   referenceVariances = variance of each parameter in the design.
+ *       Reweighting to variances no larger than these keeps the
+ *       weights bounded by 1.
+ */
+void SobolIndices::
+EvaluateReferenceDesign(const std::vector<Type> &referenceVariances)
+{
+  if (!transformPlan.IsNormal() || transformPlan.IsCorrelated())
+    {
+      std::cerr << "SobolIndices::EvaluateReferenceDesign: the design "
+		<< "needs independent normal params\n";
+      return;
+    }
+
+  std::shared_ptr<ReferenceDesign> design
+    = std::make_shared<ReferenceDesign>();
+  design->N = N_MC;
+  design->stride = (N_MC + 7) & ~7u;
+  design->variances = referenceVariances;
+  design->f.resize(numOutputs*design->stride);
+  design->f2.resize(numOutputs*design->stride);
+  design->model1.resize(numOutputs*design->stride);
+  design->model2.resize(numOutputs*design->stride);
+  design->q.resize(dim*design->stride);
+
+  std::vector<bool> inIndexSet(dim);
+  for (int j = 0; j < dim; ++j)
+    {
+      inIndexSet[j] = indices.count(j+1);
+    }
+
+  const unsigned int stride = block.stride;
+
+  for (unsigned int i = 0; i < N_MC; i += blockSize)
+    {
+      unsigned int B = std::min(blockSize, N_MC - i);
+
+      DrawBlock(randomNumberGenerator, block, i, B, referenceVariances);
+      AssignModelArguments(block, inIndexSet, B);
+
+      EvaluateModel(block, block.x1, B, block.f);
+      EvaluateModel(block, block.x2, B, block.f2);
+      EvaluateModel(block, block.arg1, B, block.model1);
+      EvaluateModel(block, block.arg2, B, block.model2);
+
+      for (unsigned int k = 0; k < numOutputs; ++k)
+	{
+	  unsigned int from = k*stride, to = k*design->stride + i;
+	  std::copy(block.f.data() + from, block.f.data() + from + B,
+		    &design->f[to]);
+	  std::copy(block.f2.data() + from, block.f2.data() + from + B,
+		    &design->f2[to]);
+	  std::copy(block.model1.data() + from,
+		    block.model1.data() + from + B, &design->model1[to]);
+	  std::copy(block.model2.data() + from,
+		    block.model2.data() + from + B, &design->model2[to]);
+	}
+
+      for (int j = 0; j < dim; ++j)
+	{
+	  Type mean = distroParams[j][0];
+	  const Type *x1 = block.x1.data() + j*stride;
+	  const Type *x2 = block.x2.data() + j*stride;
+	  Type *q = design->q.data() + j*design->stride + i;
+	  for (unsigned int b = 0; b < B; ++b)
+	    {
+	      q[b] = (x1[b] - mean)*(x1[b] - mean)
+		+ (x2[b] - mean)*(x2[b] - mean);
+	    }
+	}
+    }
+
+  if (!sampleBank)
+    {
+      sampleOffset += N_MC;
+    }
+
+  referenceDesign = design;
+}
+
+/* Estimates the Sobol' indices at new parameter variances from the
+ * reference design, without evaluating the model.  Each sample pair
+ * (x1,x2) of the design gets the likelihood ratio of the normal
+ * densities at the new and reference variances,
+ *     w = exp(-sum_j q_j/2 * (1/uncertainties[j] - 1/ref[j])),
+ * up to a constant, and the estimator sums of
+ * ComputeSensitivityIndices() become self-normalized weighted means,
+ * accumulated by weighted Welford updates.  Assigns lowerIndex,
+ * totalIndex, modelMean, modelVariance, the half widths & standard
+ * errors (and the output* vectors for every model output) and
+ * effectiveSampleSize = (sum w)^2 / sum w^2, which falls below N_MC
+ * as the variances move away from the reference ones.  Without a
+ * design, or with params that are not normal, the call is reported on
+ * stderr and the indices are left as they were.
+ *
+ * Input:
+ *   uncertainties = vector of parameter variances to use
+ */
+Type SobolIndices::
+ComputeReweightedSensitivityIndices(const std::vector<Type>
+				    &uncertainties)
+{
+  if (!referenceDesign || !transformPlan.IsNormal()
+      || transformPlan.IsCorrelated())
+    {
+      std::cerr << "SobolIndices::ComputeReweightedSensitivityIndices: "
+		<< "needs a reference design and independent normal "
+		<< "params\n";
+      return totalIndex;
+    }
+
+  const ReferenceDesign &design = *referenceDesign;
+  const unsigned int N = design.N;
+
+  logWeights.resize(design.stride);
+  std::fill(logWeights.data(), logWeights.data() + N, 0.0);
+
+  for (int j = 0; j < dim; ++j)
+    {
+      Type c = 0.5*(1.0/uncertainties[j] - 1.0/design.variances[j]);
+      const Type *q = design.q.data() + j*design.stride;
+      for (unsigned int i = 0; i < N; ++i)
+	{
+	  logWeights[i] -= c*q[i];
+	}
+    }
+
+  /* the constant cancels in the ratios; shifting by the largest log
+   * weight keeps exp() in range for any variances */
+  Type maxLogWeight = *std::max_element(logWeights.data(),
+					logWeights.data() + N);
+
+  /* weights overwrite the log weights */
+  Type w_sum = 0, w2_sum = 0;
+  for (unsigned int i = 0; i < N; ++i)
+    {
+      Type w = exp(logWeights[i] - maxLogWeight);
+      logWeights[i] = w;
+      w_sum += w;
+      w2_sum += w*w;
+    }
+
+  effectiveSampleSize = w_sum*w_sum/w2_sum;
+
+  for (unsigned int k = 0; k < numOutputs; ++k)
+    {
+      const Type *f = design.f.data() + k*design.stride;
+      const Type *f2 = design.f2.data() + k*design.stride;
+      const Type *model1 = design.model1.data() + k*design.stride;
+      const Type *model2 = design.model2.data() + k*design.stride;
+
+      /* running moments weighted by w, and by w^2 for the standard
+       * errors */
+      Type W = 0, fMean = 0, fM2 = 0;
+      Type DyMean = 0, DyM2 = 0, DTMean = 0, DTM2 = 0;
+      Type V = 0, DyMeanV = 0, DyM2V = 0, DTMeanV = 0, DTM2V = 0;
+      for (unsigned int i = 0; i < N; ++i)
+	{
+	  Type w = logWeights[i];
+	  if (w == 0)
+	    continue;
+	  Type Dy = f[i]*(model1[i] - f2[i]);
+	  Type DT = pow((f[i] - model2[i]), 2.0);
+	  W += w;
+	  V += w*w;
+	  WelfordAddWeighted(f[i], w, W, fMean, fM2);
+	  WelfordAddWeighted(Dy, w, W, DyMean, DyM2);
+	  WelfordAddWeighted(DT, w, W, DTMean, DTM2);
+	  WelfordAddWeighted(Dy, w*w, V, DyMeanV, DyM2V);
+	  WelfordAddWeighted(DT, w*w, V, DTMeanV, DTM2V);
+	}
+
+      outputMeans[k] = fMean;
+      outputVariances[k] = fM2/W;
+
+      /* non-normalized */
+      outputLowerIndices[k] = DyMean;
+      outputTotalIndices[k] = DTMean/2.0;
+
+      /* standard error of a self-normalized mean m = sum w x / W:
+       * sqrt(sum w^2 (x - m)^2)/W, the sum being the w^2-weighted M2
+       * shifted from the w^2-weighted mean to m */
+      Type lowerS = DyM2V + V*(DyMeanV - DyMean)*(DyMeanV - DyMean);
+      Type totalS = DTM2V + V*(DTMeanV - DTMean)*(DTMeanV - DTMean);
+      outputLowerStdErrors[k] = sqrt(lowerS)/W;
+      outputTotalStdErrors[k] = sqrt(totalS)/(2.0*W);
+      outputLowerHalfWidths[k] = confidenceZ*outputLowerStdErrors[k];
+      outputTotalHalfWidths[k] = confidenceZ*outputTotalStdErrors[k];
+    }
+
+  samplesUsed = N;
+  modelMean = outputMeans[0];
+  modelVariance = outputVariances[0];
+  lowerIndex = outputLowerIndices[0];
+  totalIndex = outputTotalIndices[0];
+  lowerIndexHalfWidth = outputLowerHalfWidths[0];
+  totalIndexHalfWidth = outputTotalHalfWidths[0];
+  lowerIndexStdError = outputLowerStdErrors[0];
+  totalIndexStdError = outputTotalStdErrors[0];
+
+  return totalIndex;
+}
+
+/* Computes the first-order and total Sobol' indices of every single
+ * parameter from one pass over the sample points.  Rather than
+ * calling ComputeSensitivityIndices() once per parameter (4*dim*N_MC
+ * model evaluations), each sample evaluates the model at x1, x2 and
+ * the dim mixed points C_j = (x1 with coordinate j taken from x2), for
+ * (dim+2)*N_MC evaluations in total:
+ *     lowerIndices[j] ~ mean of f(x2)*(f(C_j) - f(x1)),
+ *     totalIndices[j] ~ mean of (f(x1) - f(C_j))^2 / 2,
+ * with confidence interval half widths lowerHalfWidths[j] &
+ * totalHalfWidths[j].  For a model of K outputs, element j*K + k is
+ * for output k.  With correlated params a C_j of the joint distro
+ * cannot share x_j with x2 & the rest with x1, so each param takes
+ * the two mixed points of ComputeSensitivityIndices() instead,
+ * (2*dim+2)*N_MC evaluations (see SetCorrelation()).  Runs serially
+ * or in chunks (see SetNumThreads()).  Also assigns modelMean and
+ * modelVariance; the other index members are left with those of
+ * parameter dim.
+ *
+ * Input:
+ *   uncertainties = vector of parameter variances to use, defaulted
+ *                   to empty in header
+ */
+void SobolIndices::
+ComputeAllSingletonIndices(const std::vector<Type> &uncertainties)
+{
+  const unsigned int K = numOutputs;
+
+  /* one accumulator per parameter */
+  std::vector<SobolAccumulator> acc(dim, SobolAccumulator(K));
+
+  if (numThreads > 0)
+    {
+      unsigned int numChunks = (N_MC + chunkSize - 1)/chunkSize;
+      std::vector<SobolAccumulator>
+	chunkAcc(numChunks*dim, SobolAccumulator(K));
+
+      RunChunks([&](unsigned int t, unsigned int c,
+		    unsigned int first, unsigned int n)
+		{
+		  PositionWorker(t, sampleOffset + first);
+		  AccumulateSingletonSamples(workerRNGs[t], workerBlocks[t],
+					     first, n, uncertainties,
+					     &chunkAcc[c*dim]);
+		});
+
+      /* fixed merge order makes the sums independent of thread
+       * count */
+      for (unsigned int c = 0; c < numChunks; ++c)
+	{
+	  for (int j = 0; j < dim; ++j)
+	    {
+	      acc[j].Merge(chunkAcc[c*dim + j]);
+	    }
+	}
+
+      if (!sampleBank)
+	{
+	  SetSampleOffset(sampleOffset + N_MC);
+	}
+    }
+  else
+    {
+      AccumulateSingletonSamples(randomNumberGenerator, block, 0, N_MC,
+				 uncertainties, acc.data());
+      if (!sampleBank)
+	{
+	  sampleOffset += N_MC;
+	}
+    }
+
+  lowerIndices.resize(dim*K);
+  totalIndices.resize(dim*K);
+  lowerHalfWidths.resize(dim*K);
+  totalHalfWidths.resize(dim*K);
+  for (int j = 0; j < dim; ++j)
+    {
+      AssignIndices(acc[j]);
+      std::copy(outputLowerIndices.begin(), outputLowerIndices.end(),
+		lowerIndices.begin() + j*K);
+      std::copy(outputTotalIndices.begin(), outputTotalIndices.end(),
+		totalIndices.begin() + j*K);
+      std::copy(outputLowerHalfWidths.begin(),
+		outputLowerHalfWidths.end(), lowerHalfWidths.begin() + j*K);
+      std::copy(outputTotalHalfWidths.begin(),
+		outputTotalHalfWidths.end(), totalHalfWidths.begin() + j*K);
+    }
+}
+
+/* Draws n samples, numbered from first within this computation, and
+ * adds the single-parameter estimator terms of each parameter j+1 to
+ * acc[j].
+ */
+void SobolIndices::
+AccumulateSingletonSamples(SampleGenerator *generator, SampleBlock &blk,
+			   unsigned int first, unsigned int n,
+			   const std::vector<Type> &uncertainties,
+			   SobolAccumulator *acc)
+{
+  const unsigned int stride = blk.stride;
+
+  /* with correlation, no one point shares x2_j with x2 & x1_~j with
+   * x1, so each param gets the two mixed points of
+   * ComputeSensitivityIndices(): x1_j with x_~j given it, & x1_~j
+   * with x_j given those */
+  std::vector<TransformPlan::Conditional> conds1, conds2;
+  if (transformPlan.IsCorrelated())
+    {
+      for (int j = 0; j < dim; ++j)
+	{
+	  std::vector<bool> given(dim, false);
+	  given[j] = true;
+	  conds1.push_back(transformPlan.Condition(given));
+	  given.flip();
+	  conds2.push_back(transformPlan.Condition(given));
+	}
+    }
+
+  for (unsigned int i = 0; i < n; i += blockSize)
+    {
+      unsigned int B = std::min(blockSize, n - i);
+
+      /* generate & transform B points of 2*dim random numbers */
+      DrawBlock(generator, blk, first + i, B, uncertainties);
+
+      EvaluateModel(blk, blk.x1, B, blk.f);
+      EvaluateModel(blk, blk.x2, B, blk.f2);
+
+      if (!conds1.empty())
+	{
+	  for (int j = 0; j < dim; ++j)
+	    {
+	      MixToModelDomain(blk, conds1[j], blk.arg1, B, uncertainties);
+	      MixToModelDomain(blk, conds2[j], blk.arg2, B, uncertainties);
+	      EvaluateModel(blk, blk.arg1, B, blk.model1);
+	      EvaluateModel(blk, blk.arg2, B, blk.model2);
+	      acc[j].Add(blk.f.data(), blk.f2.data(), stride,
+			 blk.model1.data(), blk.model2.data(), stride, B);
+	    }
+	  continue;
+	}
+
+      /* arg2 holds the mixed points, swapping one column at a time */
+      std::copy(blk.x1.data(), blk.x1.data() + dim*stride,
+		blk.arg2.data());
+      for (int j = 0; j < dim; ++j)
+	{
+	  Type *column = blk.arg2.data() + j*stride;
+	  std::copy(blk.x2.data() + j*stride,
+		    blk.x2.data() + j*stride + B, column);
+	  EvaluateModel(blk, blk.arg2, B, blk.model2);
+	  std::copy(blk.x1.data() + j*stride,
+		    blk.x1.data() + j*stride + B, column);
+
+	  acc[j].AddSingleton(blk.f.data(), blk.f2.data(),
+			      blk.model2.data(), stride, B);
+	}
+    }
+}
+
+/* Evaluates the model at the first B points of a matrix of blk,
+ * writing the results to outputs, output k of point b at
+ * outputs[k*stride + b].  A batch model gets the whole block in one
+ * call; a scalar or vector model is called once per point, gathered
+ * into blk.point. */
+void SobolIndices::
+EvaluateModel(SampleBlock &blk, const AlignedBuffer<Type> &points,
+	      unsigned int B, AlignedBuffer<Type> &outputs)
+{
+  const unsigned int stride = blk.stride;
+
+  if (batchModel)
+    {
+      batchModel(points.data(), B, stride, constants, outputs.data());
+      return;
+    }
+
+  for (unsigned int b = 0; b < B; ++b)
+    {
+      for (int j = 0; j < dim; ++j)
+	{
+	  blk.point[j] = points[j*stride + b];
+	}
+      if (vectorModel)
+	{
+	  vectorModel(blk.point, constants, blk.outputs);
+	  for (unsigned int k = 0; k < numOutputs; ++k)
+	    {
+	      outputs[k*stride + b] = blk.outputs[k];
+	    }
+	}
+      else
+	{
+	  outputs[b] = model(blk.point, constants);
+	}
+    }
+}
+
+/* Function AssignModelArguments fills the two matrices of blk that
+ * will be passed to the model for evaluation in computing the Sobol'
+ * indices.  Whole columns are copied, since membership in the index set is the
+ * same for every sample.  For independent params only; with a
+ * correlation the mixed points are drawn by MixToModelDomain().
+ *
+ * Input:
+ *    blk = block holding the x1 & x2 points, gets arg1 & arg2
+ *    inIndexSet = inIndexSet[j] is true if parameter j+1 is in the
+ *        index set to compute SIs for
+ *    B = number of points in the current block
+ */
+void SobolIndices::
+AssignModelArguments(SampleBlock &blk,
+		     const std::vector<bool> &inIndexSet,
+		     unsigned int B)
+{
+  const unsigned int stride = blk.stride;
+
+  for (int j = 0; j < dim; ++j)
+    {
+      const Type *x1 = blk.x1.data() + j*stride;
+      const Type *x2 = blk.x2.data() + j*stride;
+
+      if (inIndexSet[j])
+	{
+	  std::copy(x1, x1 + B, blk.arg1.data() + j*stride);
+	  std::copy(x2, x2 + B, blk.arg2.data() + j*stride);
+	}
+      else
+	{
+	  std::copy(x2, x2 + B, blk.arg1.data() + j*stride);
+	  std::copy(x1, x1 + B, blk.arg2.data() + j*stride);
+	}
+    }
+}
+
+/* Function TransformToModelDomain draws the next B points of generator and
+ * fills the x1 and x2 matrices of blk (the points passed to the model in
+ * computation of the SIs) to fit in the model domain.  I.e., it takes
+ * each arg column, which is composed of Unif(0,1) random numbers, and
+ * transforms each component to its respective distro.  With a
+ * correlation set, the columns are taken to N(0,1) & correlated
+ * first, see SetCorrelation().
+ *
+ * Input:
+ *    generator = generator to draw from
+ *    blk = block to fill
+ *    B = number of points to generate
+ *    (optional) uncertainties = vector of parameter uncertainties,
+ *        defaulted to empty in header.  This is for use with Super
+ *        Sobol index computation.
+ */
+void SobolIndices::
+TransformToModelDomain(SampleGenerator *generator, SampleBlock &blk,
+		       unsigned int B,
+		       const std::vector<Type> &uncertainties)
+{
+  const unsigned int stride = blk.stride;
+
+  /* generate 2*dim random numbers per point, coordinates 1..dim
+   * into x1 & dim+1..2*dim into x2 */
+  generator->Generate(1, dim, B, blk.x1.data(), stride);
+  generator->Generate(dim+1, dim, B, blk.x2.data(), stride);
+
+  if (transformPlan.IsCorrelated())
+    {
+      for (int j = 0; j < dim; ++j)
+	{
+	  invTrans->Normal(blk.x1.data() + j*stride, B, 0, 1,
+			   blk.x1.data() + j*stride);
+	  invTrans->Normal(blk.x2.data() + j*stride, B, 0, 1,
+			   blk.x2.data() + j*stride);
+	}
+      CorrelateToModelDomain(blk, B, uncertainties);
+      return;
+    }
+
+  /* each column by the transform compiled for its param; if
+   * parameter uncertainty not changed, the variances are left as
+   * initial, ow changed to the new uncertainties.  (For Vasicek, which
+   * draws log a, log b, log sigma, set lognormal distros.) */
+  for (int j = 0; j < dim; ++j)
+    {
+      transformPlan.FromUniform(j, *invTrans, blk.x1.data() + j*stride, B,
+				uncertainties);
+      transformPlan.FromUniform(j, *invTrans, blk.x2.data() + j*stride, B,
+				uncertainties);
+    }
+}
+
+/* Function TransformBankToModelDomain fills the x1 and x2 matrices
+ * of blk from samples first..first+B-1 of the sample bank: a scale &
+ * shift of the stored N(0,1) numbers for normal params (& an exp for
+ * lognormal ones, F^-1(Phi(z)) for the others), no point generation or
+ * inverse normal transformation.
+ *
+ * Input:
+ *    blk = block to fill
+ *    first = number of the first bank sample to use
+ *    B = number of points
+ *    (optional) uncertainties = vector of parameter uncertainties, as
+ *        for TransformToModelDomain()
+ */
+void SobolIndices::
+TransformBankToModelDomain(SampleBlock &blk, unsigned int first,
+			   unsigned int B,
+			   const std::vector<Type> &uncertainties)
+{
+  const unsigned int stride = blk.stride;
+  const unsigned int bankStride = sampleBank->stride;
+
+  if (transformPlan.IsCorrelated())
+    {
+      for (int j = 0; j < dim; ++j)
+	{
+	  const Type *z1 = sampleBank->z1.data() + j*bankStride + first;
+	  const Type *z2 = sampleBank->z2.data() + j*bankStride + first;
+	  std::copy(z1, z1 + B, blk.x1.data() + j*stride);
+	  std::copy(z2, z2 + B, blk.x2.data() + j*stride);
+	}
+      CorrelateToModelDomain(blk, B, uncertainties);
+      return;
+    }
+
+  for (int j = 0; j < dim; ++j)
+    {
+      const Type *z1 = sampleBank->z1.data() + j*bankStride + first;
+      const Type *z2 = sampleBank->z2.data() + j*bankStride + first;
+      transformPlan.FromNormal(j, *invTrans, z1, blk.x1.data() + j*stride,
+			       B, uncertainties);
+      transformPlan.FromNormal(j, *invTrans, z2, blk.x2.data() + j*stride,
+			       B, uncertainties);
+    }
+}
+
+/* Correlates the independent N(0,1) numbers in the x1 & x2 matrices
+ * of blk, B points, keeping the correlated scores in z1 & z2 for the
+ * mixed points (see MixToModelDomain()), and transforms each column
+ * to its distro: the Nataf transformation x = F^-1(Phi(z)) (a scale &
+ * shift for normal params).  uncertainties as for
+ * TransformToModelDomain().
+ */
+void SobolIndices::
+CorrelateToModelDomain(SampleBlock &blk, unsigned int B,
+		       const std::vector<Type> &uncertainties)
+{
+  const unsigned int stride = blk.stride;
+
+  std::copy(blk.x1.data(), blk.x1.data() + dim*stride, blk.z1.data());
+  std::copy(blk.x2.data(), blk.x2.data() + dim*stride, blk.z2.data());
+  transformPlan.Correlate(blk.z1.data(), stride, B);
+  transformPlan.Correlate(blk.z2.data(), stride, B);
+  for (int j = 0; j < dim; ++j)
+    {
+      transformPlan.FromNormal(j, *invTrans, blk.z1.data() + j*stride,
+			       blk.x1.data() + j*stride, B, uncertainties);
+      transformPlan.FromNormal(j, *invTrans, blk.z2.data() + j*stride,
+			       blk.x2.data() + j*stride, B, uncertainties);
+    }
+}
+
+/* Fills arg, a matrix of blk, with a mixed point of B samples for
+ * correlated params: the params given in cond from the scores z1 of
+ * x1, the others drawn given those from the scores z2 of x2 (see
+ * TransformPlan::Mix()), each column then taken to its distro.  So
+ * arg shares exactly the given params with x1 and has the joint
+ * distro.  uncertainties as for TransformToModelDomain().
+ */
+void SobolIndices::
+MixToModelDomain(SampleBlock &blk, const TransformPlan::Conditional &cond,
+		 AlignedBuffer<Type> &arg, unsigned int B,
+		 const std::vector<Type> &uncertainties)
+{
+  const unsigned int stride = blk.stride;
+
+  transformPlan.Mix(cond, blk.z1.data(), blk.z2.data(), arg.data(),
+		    stride, B);
+  for (int j = 0; j < dim; ++j)
+    {
+      Type *x = arg.data() + j*stride;
+      transformPlan.FromNormal(j, *invTrans, x, x, B, uncertainties);
+    }
+}
+
+/* Computes the indices for the range of CoVs in the CoV_ vector: at
+ * each CoV the parameters of the ctor's index set get variance
+ * (mean*CoV)^2, the others keep their initial variance.  The resulting
+ * indices are stored in a 2D vector:
+ *     first row = total index of origianl set,
+ *     second row = lower index of complement set,
+ *     third row = model variance.
+ * These indices are written to a file for plotting.
+ *
+ * Every CoV rescales the same base points (the sample bank, drawn
+ * here if none is set), so the curves are smooth in the CoV even at
+ * small N_MC, and no CoV pays for generating & inverse-transforming
+ * points.  The set and its complement need the same two mixed points,
+ * so each CoV costs 4*N_MC model evaluations for both indices.  After
+ * SetNumThreads(), the CoVs are spread over the threads, each with its
+ * own copy of this object; the results do not depend on the thread
+ * count.
+ *
+ * Input:
+ *     CoV_Vector = vector of CoVs to use in plotting
+ *     filename = name of file for plotting
+ */
+std::vector<std::vector<Type> > SobolIndices::
+PlotCoV(const std::vector<Type> &CoV_Vector,
+	std::string &filename)
+{
+  std::cout << "PlotCoV \n";
+
+  /* allocate Sobol index vectors */
+  size_t num_CoV = CoV_Vector.size();
+  std::vector<std::vector<Type> > 
+    results(3, std::vector<Type>(num_CoV));
+
+  /* construct set containing complement of current param index */
+  std::set<int> complement_indices;
+  for (int i = 0; i < dim; ++i)
+    {
+      /* true if "i" is in index set */
+      bool inIndexSet = indices.count(i+1);
+
+      /* add index to complement set if not in original index set */
+      if (!inIndexSet)
+	{
+	  complement_indices.insert(i+1);
+	}
+    }
+
+  std::vector<std::set<int> > sets;
+  sets.push_back(indices);
+  sets.push_back(complement_indices);
+  IndexSetPlan plan;
+  CompileIndexSets(sets, dim, plan);
+
+  /* common random numbers for all CoVs */
+  bool ownsBank = !sampleBank;
+  if (ownsBank)
+    {
+      GenerateSampleBank();
+    }
+
+  /* computes the indices at CoV i with sobol */
+  auto compute = [&](SobolIndices &sobol, size_t i)
+    {
+      std::vector<Type> uncertainties(dim);
+      for (int j = 0; j < dim; ++j)
+	{
+	  uncertainties[j] = indices.count(j+1) ?
+	    pow(distroParams[j][0]*CoV_Vector[i], 2.0) : distroParams[j][1];
+	}
+
+      sobol.ComputeIndexSets(plan, uncertainties);
+
+      /* total index of original set, lower index of complement set
+       * & model variance, of output 0 */
+      results[0][i] = sobol.setTotalIndices[0];
+      results[1][i] = sobol.setLowerIndices[numOutputs];
+      results[2][i] = sobol.modelVariance;
+    };
+
+  if (numThreads > 0 && num_CoV > 0)
+    {
+      unsigned int T = std::min((size_t)numThreads, num_CoV);
+      std::vector<SobolIndices*> copies(T);
+      for (unsigned int t = 0; t < T; ++t)
+	{
+	  copies[t] = new SobolIndices(*this);
+	}
+
+      std::atomic<size_t> next(0);
+      auto loop = [&](unsigned int t)
+	{
+	  size_t i;
+	  while ((i = next++) < num_CoV)
+	    {
+	      compute(*copies[t], i);
+	    }
+	};
+
+      std::vector<std::thread> threads;
+      for (unsigned int t = 1; t < T; ++t)
+	{
+	  threads.push_back(std::thread(loop, t));
+	}
+      loop(0);
+      for (size_t t = 0; t < threads.size(); ++t)
+	{
+	  threads[t].join();
+	}
+
+      for (unsigned int t = 0; t < T; ++t)
+	{
+	  delete copies[t];
+	}
+    }
+  else
+    {
+      for (size_t i = 0; i < num_CoV; ++i)
+	{
+	  compute(*this, i);
+	}
+    }
+
+  if (ownsBank)
+    {
+      ClearSampleBank();
+    }
+  if (num_CoV > 0)
+    {
+      CoV = CoV_Vector[num_CoV-1];
+    }
+
+  /* open plotting file and write data to it */
+  std::ofstream plotFile(filename.c_str());
+  if (plotFile.is_open())
+    {
+      for (size_t i = 0; i < num_CoV; ++i)
+	{
+	  plotFile << CoV_Vector[i] << " " << results[0][i] << " " 
+		   << results[1][i] << " " << " " 
+		   << results[2][i] << "\n";
+	}
+    }
+  else
+    {
+      std::cout << "unable to open plot file \n";
+    }
+
+  /* close plotting file */
+  plotFile.close();
 
-  // /* allocate Sobol index vectors */
-  // size_t num_CoV = CoV_Vector.size();
-  // std::vector<std::vector<Type> > 
-  //   results(3, std::vector<Type>(num_CoV));
-
-  // /* construct set containing complement of current param index */
-  // std::set<int> complement_indices;
-  // for (int i = 0; i < dim; ++i)
-  //   {
-  //     /* true if "i" is in index set */
-  //     bool inIndexSet = indices.count(i+1);
-
-  //     /* add index to complement set if not in original index set */
-  //     if (!inIndexSet)
-  // 	{
-  // 	  complement_indices.insert(i+1);
-  // 	}
-  //   }
-
-  // /* compute sensitivity indices */
-  // for (int i = 0; i < num_CoV; ++i)
-  //   {
-  //     /* change the class' CoV to the current one in the vector */
-  //     CoV = CoV_Vector[i];
-
-  //     /* compute the sobol indices for original index using this CoV */
-  //     ComputeSensitivityIndices();
-
-  //     /* store total index of original set in index vector */
-  //     results[0][i] = totalIndex;
-
-  //     /* compute sobol indices for complement set */
-  //     ComputeSensitivityIndices(complement_indices);
-
-  //     /* store lower index of complement set in index vector */
-  //     results[1][i] = lowerIndex;
-
-  //     /* store model variance */
-  //     results[2][i] = modelVariance;
-  //   }
-
-  // /* open plotting file and write data to it */
-  // std::ofstream plotFile(filename.c_str());
-  // if (plotFile.is_open())
-  //   {
-  //     for (int i = 0; i < num_CoV; ++i)
-  // 	{
-  // 	  plotFile << CoV_Vector[i] << " " << results[0][i] << " " 
-  // 		   << results[1][i] << " " << " " 
-  // 		   << results[2][i] << "\n";
-  // 	}
-  //   }
-  // else
-  //   {
-  //     std::cout << "unable to open plot file \n";
-  //   }
-
-  // /* close plotting file */
-  // plotFile.close();
-
-  // /* return Sobol indices */
-  // return results;
+  /* return Sobol indices */
+  return results;
 }
 
 void SobolIndices::DisplayVector(const std::vector<Type>& vec)
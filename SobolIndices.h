@@ -8,36 +8,347 @@
 #define _USE_MATH_DEFINES  /* M_PI for math constant pi */
 
 #include <iostream>
+#include <climits>
 #include <vector>
 #include <set>
 #include <fstream>
-#include "Halton.h"
+#include <memory>
+#include <functional>
+#include "SampleGenerator.h"
 #include "MT64.h"
 #include "InverseTransformation.h"
+#include "ParameterDistribution.h"
+#include "AlignedBuffer.h"
 
 typedef double Type;
 
+/* Batch model: evaluates B points in one call.  The points are stored
+ * structure-of-arrays, parameter j of point b at
+ * parameters[j*stride + b] (stride >= B, each column aligned), and
+ * the B results are written to outputs[0..B-1], or for a model of K
+ * outputs output k of point b to outputs[k*stride + b].  Second arg
+ * is the vector of fixed constants, as for the scalar model. */
+typedef void (*BatchModel)(const Type *parameters,
+			   unsigned int B,
+			   unsigned int stride,
+			   const std::vector<Type> &constants,
+			   Type *outputs);
+
+/* Vector-valued model: as the scalar model, but writes its K outputs
+ * (a price ladder, a time series, ...) to the third arg, which has
+ * size K on entry. */
+typedef void (*VectorModel)(const std::vector<Type> &parameters,
+			    const std::vector<Type> &constants,
+			    std::vector<Type> &outputs);
+
+/* Scratch for one block of samples.  The x/arg matrices are dim
+ * columns of "stride" elements, the f's K rows of "stride" elements,
+ * one per model output. */
+struct SampleBlock
+{
+  unsigned int stride;  /* column length, multiple of 8 */
+  AlignedBuffer<Type> x1, x2, arg1, arg2;  /* model args, SoA */
+  AlignedBuffer<Type> f, f2, model1, model2;  /* model evaluations */
+  AlignedBuffer<Type> mixed;  /* f at each mixed point of a plan */
+  /* correlated N(0,1) scores of x1 & x2, with a correlation set */
+  AlignedBuffer<Type> z1, z2;
+  std::vector<Type> point;  /* one gathered point for scalar model */
+  std::vector<Type> outputs;  /* outputs of one point, vector model */
+
+  void Allocate(int dim, unsigned int blockSize,
+		unsigned int numOutputs = 1);
+};
+
+/* Standard-normal draws for N points, laid out like a SampleBlock:
+ * column j of z1 (z2) holds coordinate j of x1 (x2) as N(0,1)
+ * numbers, so x = mean + sqrt(var)*z for any variance. */
+struct NormalSampleBank
+{
+  unsigned int N;  /* number of points */
+  unsigned int stride;  /* column length, multiple of 8 */
+  AlignedBuffer<Type> z1, z2;
+};
+
+/* Model evaluations at a fixed reference design, from which the
+ * indices at other variances are estimated by reweighting; see
+ * EvaluateReferenceDesign().  q column j holds
+ * (x1_j - mean_j)^2 + (x2_j - mean_j)^2 of each sample. */
+struct ReferenceDesign
+{
+  unsigned int N;  /* number of samples */
+  unsigned int stride;  /* column length, multiple of 8 */
+  std::vector<Type> variances;  /* reference variance of each param */
+  /* model evaluations, K rows of stride */
+  AlignedBuffer<Type> f, f2, model1, model2;
+  AlignedBuffer<Type> q;  /* squared deviations from the means */
+};
+
+/* Base samples of one computation, shared by the index sets computed
+ * on it; see BeginRun().  Keeps where the samples start in the
+ * sequence (or the sample bank they came from) and the model outputs
+ * at them, f(x1) and f(x2). */
+struct SobolRunContext
+{
+  unsigned int N;  /* number of samples */
+  uint64 sampleOffset;  /* first point of the run in the sequence */
+  /* the bank the samples came from, NULL if from the sequence; held
+   * so the bank is not regenerated in place under the run */
+  std::shared_ptr<NormalSampleBank> sampleBank;
+  std::vector<Type> uncertainties;  /* variances the run was drawn at */
+  /* model evaluations at x1 & x2, output k of sample i at [k*N + i] */
+  AlignedBuffer<Type> f, f2;
+};
+
+/* A list of index sets compiled for ComputeIndexSets().  Set u needs
+ * the mixed points arg1 = M(u) and arg2 = M(complement of u), where
+ * M(mask) takes coordinate j from x1 if bit j-1 of mask is set and
+ * from x2 otherwise.  Each distinct mask is evaluated once per sample:
+ * M(all) = x1 and M(none) = x2 are f & f2 themselves, and a set's
+ * complement or a repeated set shares its points. */
+struct IndexSetPlan
+{
+  int dim;  /* number of model parameters */
+  std::vector<std::set<int> > sets;  /* the index sets, as given */
+  std::vector<std::vector<uint64> > masks;  /* distinct mixed points */
+  /* per set: point giving arg1 & arg2, an index into masks or
+   * PLAN_X1 (= f) or PLAN_X2 (= f2) */
+  std::vector<int> arg1Point, arg2Point;
+
+  static const int PLAN_X1 = -1;
+  static const int PLAN_X2 = -2;
+};
+
+/* Welford update of the mean & sum of squared deviations M2 of a
+ * sequence with its n-th value x */
+inline void WelfordAdd(Type x, uint64 n, Type &mean, Type &M2)
+{
+  Type delta = x - mean;
+  mean += delta/n;
+  M2 += delta*(x - mean);
+}
+
+/* Weighted form of WelfordAdd() (West 1979): adds x with weight w,
+ * W being the sum of the weights including w; M2 is then the
+ * weighted sum of squared deviations */
+inline void WelfordAddWeighted(Type x, Type w, Type W, Type &mean,
+			       Type &M2)
+{
+  Type delta = x - mean;
+  mean += delta*(w/W);
+  M2 += w*delta*(x - mean);
+}
+
+/* Combines the moments (n, mean, M2) of one range of values with the
+ * moments (m, otherMean, otherM2) of another (Chan, Golub & LeVeque),
+ * so no large sums of squares are ever subtracted */
+inline void WelfordMerge(uint64 n, Type &mean, Type &M2,
+			 uint64 m, Type otherMean, Type otherM2)
+{
+  uint64 total = n + m;
+  Type delta = otherMean - mean;
+  mean += delta*m/total;
+  M2 += otherM2 + delta*delta*((Type)n*m/total);
+}
+
+/* Running moments of the Sobol' index estimators of K model outputs
+ * over a range of samples: mean & M2 of f, of the lower-index term
+ * f*(model1 - f2) and of the total-index term (f - model2)^2.  The
+ * moments are stored structure-of-arrays, element k of each array
+ * for output k.  Partial moments of separate ranges are combined with
+ * Merge(). */
+struct SobolAccumulator
+{
+  unsigned int K;  /* number of outputs */
+  uint64 n;  /* number of samples */
+  std::vector<Type> fMean, fM2, DyMean, DyM2, DTMean, DTM2;
+
+  explicit SobolAccumulator(unsigned int K_ = 1)
+    : K(K_), n(0), fMean(K_, 0), fM2(K_, 0), DyMean(K_, 0),
+    DyM2(K_, 0), DTMean(K_, 0), DTM2(K_, 0) {}
+
+  /* adds B samples, output k of sample b being f[k*fStride + b] (f2
+   * likewise) and model1[k*modelStride + b] (model2 likewise) */
+  void Add(const Type *f, const Type *f2, unsigned int fStride,
+	   const Type *model1, const Type *model2,
+	   unsigned int modelStride, unsigned int B)
+  {
+    for (unsigned int k = 0; k < K; ++k)
+      {
+	const Type *fk = f + k*fStride, *f2k = f2 + k*fStride;
+	const Type *model1k = model1 + k*modelStride;
+	const Type *model2k = model2 + k*modelStride;
+	for (unsigned int b = 0; b < B; ++b)
+	  {
+	    uint64 m = n + b + 1;
+	    WelfordAdd(fk[b], m, fMean[k], fM2[k]);
+	    WelfordAdd(fk[b]*(model1k[b] - f2k[b]), m, DyMean[k], DyM2[k]);
+	    WelfordAdd(pow((fk[b] - model2k[b]), 2.0), m,
+		       DTMean[k], DTM2[k]);
+	  }
+      }
+    n += B;
+  }
+  /* adds B samples of the single-parameter estimator of
+   * SobolIndices::ComputeAllSingletonIndices(): f(x1), f(x2) & f(C_j)
+   * at f, f2 & mixed (output k at k*stride + b), the lower-index term
+   * being f2*(mixed - f) and the total-index term (f - mixed)^2 */
+  void AddSingleton(const Type *f, const Type *f2, const Type *mixed,
+		    unsigned int stride, unsigned int B)
+  {
+    for (unsigned int k = 0; k < K; ++k)
+      {
+	const Type *fk = f + k*stride, *f2k = f2 + k*stride;
+	const Type *mixedk = mixed + k*stride;
+	for (unsigned int b = 0; b < B; ++b)
+	  {
+	    uint64 m = n + b + 1;
+	    WelfordAdd(fk[b], m, fMean[k], fM2[k]);
+	    WelfordAdd(f2k[b]*(mixedk[b] - fk[b]), m, DyMean[k], DyM2[k]);
+	    WelfordAdd(pow((fk[b] - mixedk[b]), 2.0), m,
+		       DTMean[k], DTM2[k]);
+	  }
+      }
+    n += B;
+  }
+  void Merge(const SobolAccumulator &other)
+  {
+    if (other.n == 0)
+      return;
+    for (unsigned int k = 0; k < K; ++k)
+      {
+	WelfordMerge(n, fMean[k], fM2[k], other.n,
+		     other.fMean[k], other.fM2[k]);
+	WelfordMerge(n, DyMean[k], DyM2[k], other.n,
+		     other.DyMean[k], other.DyM2[k]);
+	WelfordMerge(n, DTMean[k], DTM2[k], other.n,
+		     other.DTMean[k], other.DTM2[k]);
+      }
+    n += other.n;
+  }
+  /* population variance, M2/n */
+  Type Variance(Type M2) const {return n > 0 ? M2/n : 0;}
+  /* variance of the mean, M2/(n(n-1)) */
+  Type MeanVariance(Type M2) const
+  {return n > 1 ? M2/((Type)n*(n - 1)) : 0;}
+};
 
 class SobolIndices
 {
  private:
   Type (*model)(const std::vector<Type>&,
 		const std::vector<Type>&);  /* model */
+  BatchModel batchModel;  /* batch model, NULL if model is scalar */
+  VectorModel vectorModel;  /* vector-valued model, or NULL */
+  unsigned int numOutputs;  /* K, number of model outputs */
   int dim;  /* number of model parameters */
   unsigned int N_MC;  /* no. of MC runs to use */
+  unsigned int blockSize;  /* samples generated & evaluated at once */
   Type CoV;  /* coefficient of variation = std/mean */
 
   /* Sobol indices */
   Type lowerIndex, totalIndex, modelVariance, modelMean;
-  std::vector<Type> x1, x2, arg1, arg2;  /* model args */
+  /* confidence interval half widths of lowerIndex & totalIndex, from
+   * the sample variance of the estimator terms; confidenceZ is the
+   * normal quantile of the confidence level */
+  Type lowerIndexHalfWidth, totalIndexHalfWidth, confidenceZ;
+  /* standard errors of lowerIndex & totalIndex */
+  Type lowerIndexStdError, totalIndexStdError;
+  unsigned int samplesUsed;  /* samples behind the last estimate */
+  /* the above of each model output; the scalars are for output 0 */
+  std::vector<Type> outputLowerIndices, outputTotalIndices;
+  std::vector<Type> outputLowerHalfWidths, outputTotalHalfWidths;
+  std::vector<Type> outputLowerStdErrors, outputTotalStdErrors;
+  std::vector<Type> outputMeans, outputVariances;
+  /* first-order & total indices of each parameter and their
+   * confidence interval half widths, filled by
+   * ComputeAllSingletonIndices(); element j*K + k is for parameter
+   * j+1 and output k */
+  std::vector<Type> lowerIndices, totalIndices;
+  std::vector<Type> lowerHalfWidths, totalHalfWidths;
+  /* lower & total indices of each set passed to ComputeIndexSets(),
+   * element s*K + k for set s and output k */
+  std::vector<Type> setLowerIndices, setTotalIndices;
+  SampleBlock block;  /* model args & evaluations of current block */
   std::vector<Type> constants;  /* model constants: K,r,... */
   std::set<int> indices;  /* index set to compute Sobol indices for */
 
   /* distribution params of model params */
   std::vector<std::vector<Type> > distroParams;
-  halton *randomNumberGenerator;  /* halton (RASRAP) object */
+  /* transformation of each param to its distro, see SetDistributions() */
+  TransformPlan transformPlan;
+  SamplerType sampler;  /* type of randomNumberGenerator */
+  SampleGenerator *randomNumberGenerator;  /* 2*dim-coordinate points */
   InverseTransformation *invTrans; /* inverse tarsnformation object */
 
+  /* Position in the sequence: the next point drawn is number
+   * sampleOffset counted from its (random) start. */
+  uint64 sampleOffset;
+
+  /* threaded mode, see SetNumThreads(); numThreads = 0 is serial */
+  unsigned int numThreads;
+  unsigned int chunkSize;  /* samples per independently summed chunk */
+  std::vector<SampleGenerator*> workerRNGs;  /* clone per thread */
+  std::vector<SampleBlock> workerBlocks;  /* one block per thread */
+
+  /* if set, samples come from this bank instead of the generator;
+   * read-only, so copies of this object share it */
+  std::shared_ptr<NormalSampleBank> sampleBank;
+
+  /* reference design for ComputeReweightedSensitivityIndices(), read
+   * only & shared by copies; logWeights is scratch */
+  std::shared_ptr<ReferenceDesign> referenceDesign;
+  AlignedBuffer<Type> logWeights;
+  Type effectiveSampleSize;  /* of the last reweighted estimate */
+
+  void Initialize();
+  void DeleteWorkers();
+  void DrawBlock(SampleGenerator *generator, SampleBlock &blk,
+		 unsigned int first, unsigned int B,
+		 const std::vector<Type> &uncertainties);
+  void AccumulateSamples(SampleGenerator *generator, SampleBlock &blk,
+			 unsigned int first, unsigned int n,
+			 const std::vector<Type> &uncertainties,
+			 const std::vector<bool> &inIndexSet,
+			 SobolAccumulator &acc,
+			 const SobolRunContext *run = NULL);
+  void Accumulate(const std::vector<Type> &uncertainties,
+		  const std::vector<bool> &inIndexSet,
+		  SobolAccumulator &acc,
+		  const SobolRunContext *run = NULL);
+  void RunTasks(const std::function<void(unsigned int t,
+					 unsigned int task)> &work,
+		unsigned int firstTask, unsigned int endTask);
+  void RunChunks(const std::function<void(unsigned int t,
+					  unsigned int c,
+					  unsigned int first,
+					  unsigned int n)> &work,
+		 unsigned int firstChunk = 0,
+		 unsigned int endChunk = UINT_MAX);
+  void PositionWorker(unsigned int t, uint64 n);
+  void AssignIndices(const SobolAccumulator &acc);
+  void AssignReplicateIndices(const std::vector<SobolAccumulator>
+			      &replicateAcc);
+  void IndexSetMembership(const std::set<int> &indices_,
+			  std::vector<bool> &inIndexSet);
+  void AccumulateSingletonSamples(SampleGenerator *generator,
+				  SampleBlock &blk, unsigned int first,
+				  unsigned int n,
+				  const std::vector<Type> &uncertainties,
+				  SobolAccumulator *acc);
+  void AccumulateIndexSetSamples(SampleGenerator *generator, SampleBlock &blk,
+				 unsigned int first, unsigned int n,
+				 const std::vector<Type> &uncertainties,
+				 const IndexSetPlan &plan,
+				 SobolAccumulator *acc);
+  void EvaluateModel(SampleBlock &blk, const AlignedBuffer<Type> &points,
+		     unsigned int B, AlignedBuffer<Type> &outputs);
+  void CorrelateToModelDomain(SampleBlock &blk, unsigned int B,
+			      const std::vector<Type> &uncertainties);
+  void MixToModelDomain(SampleBlock &blk,
+			const TransformPlan::Conditional &cond,
+			AlignedBuffer<Type> &arg, unsigned int B,
+			const std::vector<Type> &uncertainties);
+
  public:
   SobolIndices(Type (*model_)(const std::vector<Type>&,
 			      const std::vector<Type>&),
@@ -47,17 +358,115 @@ class SobolIndices
 	       &initialDistroParams_,
 	       int dim_,
 	       unsigned int N_MC_,
-	       Type CoV_ = 1.0);
+	       Type CoV_ = 1.0,
+	       SamplerType sampler_ = SAMPLER_HALTON);
+  SobolIndices(BatchModel batchModel_,
+	       const std::vector<Type> &constants_,
+	       const std::set<int> &indices_,
+	       const std::vector<std::vector<Type> >
+	       &initialDistroParams_,
+	       int dim_,
+	       unsigned int N_MC_,
+	       unsigned int blockSize_ = 256,
+	       Type CoV_ = 1.0,
+	       SamplerType sampler_ = SAMPLER_HALTON);
+  SobolIndices(VectorModel vectorModel_,
+	       unsigned int numOutputs_,
+	       const std::vector<Type> &constants_,
+	       const std::set<int> &indices_,
+	       const std::vector<std::vector<Type> >
+	       &initialDistroParams_,
+	       int dim_,
+	       unsigned int N_MC_,
+	       Type CoV_ = 1.0,
+	       SamplerType sampler_ = SAMPLER_HALTON);
+  SobolIndices(BatchModel batchModel_,
+	       unsigned int numOutputs_,
+	       const std::vector<Type> &constants_,
+	       const std::set<int> &indices_,
+	       const std::vector<std::vector<Type> >
+	       &initialDistroParams_,
+	       int dim_,
+	       unsigned int N_MC_,
+	       unsigned int blockSize_ = 256,
+	       Type CoV_ = 1.0,
+	       SamplerType sampler_ = SAMPLER_HALTON);
+  SobolIndices(const SobolIndices &other);
+  /* a copy clones the generators (see the copy ctor); assignment
+   * would share them, so there is none */
+  SobolIndices &operator=(const SobolIndices &other) = delete;
   void DisplayMembers();
-  Type ComputeSensitivityIndices(const std::vector<Type> 
-				 &uncertainties,
+  Type ComputeSensitivityIndices(const std::vector<Type>
+				 &uncertainties = std::vector<Type>(),
+				 const std::set<int> &indices_
+				 = std::set<int>());
+  Type ComputeSensitivityIndicesToPrecision(Type tolerance,
+					    const std::vector<Type>
+					    &uncertainties
+					    = std::vector<Type>(),
+					    const std::set<int> &indices_
+					    = std::set<int>(),
+					    unsigned int minSamples = 1000);
+  Type ComputeReplicatedSensitivityIndices(unsigned int R,
+					   Type tolerance = 0,
+					   const std::vector<Type>
+					   &uncertainties
+					   = std::vector<Type>(),
+					   const std::set<int> &indices_
+					   = std::set<int>(),
+					   unsigned int minSamples = 1000);
+  void ComputeAllSingletonIndices(const std::vector<Type>
+				  &uncertainties = std::vector<Type>());
+  static bool CompileIndexSets(const std::vector<std::set<int> >
+			       &indexSets, int dim_,
+			       IndexSetPlan &plan);
+  static std::vector<std::set<int> > PairIndexSets(int dim_);
+  void ComputeIndexSets(const IndexSetPlan &plan,
+			const std::vector<Type> &uncertainties
+			= std::vector<Type>());
+  void ComputeIndexSets(const std::vector<std::set<int> > &indexSets,
+			const std::vector<Type> &uncertainties
+			= std::vector<Type>());
+  void BeginRun(SobolRunContext &run,
+		const std::vector<Type> &uncertainties
+		= std::vector<Type>());
+  Type ComputeSensitivityIndices(const SobolRunContext &run,
 				 const std::set<int> &indices_
 				 = std::set<int>());
-  void AssignModelArguments(const std::set<int>& indices_);
-  void TransformToModelDomain(const std::vector<Type> &uncertainties
+  void SetNumThreads(unsigned int numThreads_,
+		     unsigned int chunkSize_ = 4096);
+  void SetSampleOffset(uint64 n);
+  uint64 GetSampleOffset() {return sampleOffset;}
+  unsigned int GetN_MC() {return N_MC;}
+  void GenerateSampleBank();
+  void ClearSampleBank() {sampleBank.reset();}
+  std::shared_ptr<NormalSampleBank> GetSampleBank()
+    {return sampleBank;}
+  void SetSampleBank(const std::shared_ptr<NormalSampleBank> &bank)
+  {sampleBank = bank;}
+  void EvaluateReferenceDesign(const std::vector<Type>
+			       &referenceVariances);
+  Type ComputeReweightedSensitivityIndices(const std::vector<Type>
+					   &uncertainties);
+  std::shared_ptr<ReferenceDesign> GetReferenceDesign()
+    {return referenceDesign;}
+  void SetReferenceDesign(const std::shared_ptr<ReferenceDesign>
+			  &design)
+  {referenceDesign = design;}
+  Type GetEffectiveSampleSize() {return effectiveSampleSize;}
+  void AssignModelArguments(SampleBlock &blk,
+			    const std::vector<bool> &inIndexSet,
+			    unsigned int B);
+  void TransformToModelDomain(SampleGenerator *generator, SampleBlock &blk,
+			      unsigned int B,
+			      const std::vector<Type> &uncertainties
 			      = std::vector<Type>());
+  void TransformBankToModelDomain(SampleBlock &blk, unsigned int first,
+				  unsigned int B,
+				  const std::vector<Type> &uncertainties
+				  = std::vector<Type>());
   std::vector<std::vector<Type> >
-    PlotCoV(const std::vector<Type> &CoV_Vector, 
+    PlotCoV(const std::vector<Type> &CoV_Vector,
 	    std::string &filename);
 
   void DisplayVector(const std::vector<Type>& vec);
@@ -65,10 +474,46 @@ class SobolIndices
   void DisplayVector(const std::vector<std::vector<Type> >& vec);
   Type GetLowerIndex() {return lowerIndex;}
   Type GetTotalIndex() {return totalIndex;}
+  Type GetLowerIndexHalfWidth() {return lowerIndexHalfWidth;}
+  Type GetTotalIndexHalfWidth() {return totalIndexHalfWidth;}
+  Type GetLowerIndexStdError() {return lowerIndexStdError;}
+  Type GetTotalIndexStdError() {return totalIndexStdError;}
+  unsigned int GetSamplesUsed() {return samplesUsed;}
+  unsigned int GetNumOutputs() {return numOutputs;}
+  const std::vector<Type>& GetOutputLowerIndices()
+    {return outputLowerIndices;}
+  const std::vector<Type>& GetOutputTotalIndices()
+    {return outputTotalIndices;}
+  const std::vector<Type>& GetOutputLowerHalfWidths()
+    {return outputLowerHalfWidths;}
+  const std::vector<Type>& GetOutputTotalHalfWidths()
+    {return outputTotalHalfWidths;}
+  const std::vector<Type>& GetOutputLowerStdErrors()
+    {return outputLowerStdErrors;}
+  const std::vector<Type>& GetOutputTotalStdErrors()
+    {return outputTotalStdErrors;}
+  const std::vector<Type>& GetOutputMeans() {return outputMeans;}
+  const std::vector<Type>& GetOutputVariances()
+    {return outputVariances;}
+  void SetConfidenceLevel(Type level);
+  void SetInverseNormalMethod(InverseNormalMethod method);
+  bool SetDistributions(const std::vector<ParameterDistribution>
+			&distros);
+  bool SetCorrelation(const std::vector<std::vector<Type> >
+		      &correlation);
+  const std::vector<Type>& GetLowerIndices() {return lowerIndices;}
+  const std::vector<Type>& GetTotalIndices() {return totalIndices;}
+  const std::vector<Type>& GetLowerHalfWidths() {return lowerHalfWidths;}
+  const std::vector<Type>& GetTotalHalfWidths() {return totalHalfWidths;}
+  const std::vector<Type>& GetSetLowerIndices()
+    {return setLowerIndices;}
+  const std::vector<Type>& GetSetTotalIndices()
+    {return setTotalIndices;}
   /* void SetDistroParams(const std::vector<std::vector<Type> >& */
   /* 		       distroParams_); */
   ~SobolIndices()
     {
+      DeleteWorkers();
       delete randomNumberGenerator;
       delete invTrans;
     }
@@ -2,7 +2,7 @@
 
 # g++ -O2 -std=c++0x SobolIndices.cpp SobolIndicesDriver.cpp Halton.cpp MT64.cpp InverseTransformation.cpp 
 
-g++ -O2 -std=c++0x SobolIndices.cpp SobolIndicesDriver.cpp Halton.cpp MT64.cpp InverseTransformation.cpp MersenneTwister.cpp pdflib.cpp rnglib.cpp
+g++ -O2 -std=c++0x -pthread SobolIndices.cpp ParameterDistribution.cpp TabulatedInverseCDF.cpp SobolIndicesDriver.cpp SampleGenerator.cpp LatticeVectors.cpp Halton.cpp SobolSequence.cpp SobolDirections.cpp MT64.cpp InverseTransformation.cpp MersenneTwister.cpp pdflib.cpp rnglib.cpp
 
 # ./a.out 20000
 # ./a.out 50000
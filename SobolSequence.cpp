@@ -0,0 +1,250 @@
+#include <cassert>
+#include <cstring>
+#include "SobolSequence.h"
+
+
+//Cell centre of the SOBOL_BITS-bit coordinate x, in (0,1); x fits a
+//signed integer, whose conversion is a single instruction
+static inline real to_unit(uint64 x)
+{
+	return ((int64)x + 0.5) * (1.0 / (1ULL << SOBOL_BITS));
+}
+
+sobol_tables::sobol_tables(uint16 d)
+{
+	dim = d;
+	v = new uint64[d * SOBOL_BITS];
+	shift = new uint64[d];
+	memset(shift, 0, d * sizeof(uint64));
+}
+
+sobol_tables::~sobol_tables()
+{
+	delete [] v;
+	delete [] shift;
+}
+
+sobol_sequence::sobol_sequence(bool isMaster)
+{
+	dim = 0;
+	x = NULL;
+	next = NULL;
+	v = NULL;
+	shift = NULL;
+	pgR64 = genRand_64::Instance();
+	ownRNG = NULL;
+	isScrambled = false;
+	isMasterThread = isMaster;
+}
+
+sobol_sequence::~sobol_sequence()
+{
+	delete [] x;
+	delete [] next;
+	delete ownRNG;
+}
+
+void sobol_sequence::set_dim(uint16 d)
+{
+	assert(d >= 1 && d <= SOBOL_DIM);
+	if(d != dim || !x)
+	{
+		delete [] x;
+		delete [] next;
+		x = new uint64[d];
+		next = new uint64[d];
+	}
+	dim = d;
+}
+
+void sobol_sequence::set_tables(const std::shared_ptr<sobol_tables> &t)
+{
+	tables = t;
+	v = t->v;
+	shift = t->shift;
+}
+
+//As halton::set_seed(): the scramble of init() comes from a generator
+//of this instance.  Call before init().
+void sobol_sequence::set_seed(uint64 seed)
+{
+	delete ownRNG;
+	ownRNG = new genRand_64(seed);
+	pgR64 = ownRNG;
+}
+
+//A master builds new tables, so workers attached before keep the old
+//ones; a worker must be attach()ed instead.
+void sobol_sequence::init(uint16 dim, bool scramble)
+{
+	assert(isMasterThread);
+	set_dim(dim);
+	set_tables(std::make_shared<sobol_tables>(dim));
+	isScrambled = scramble;
+	set_direction_numbers();
+	if(isScrambled)
+	{
+		std::unique_lock<std::mutex> lock(genRand_64::InstanceMutex(),
+						  std::defer_lock);
+		if(!ownRNG)
+			lock.lock();
+		this->scramble();
+	}
+	seek(0);
+}
+
+//Follows master's sequence from its start; use seek() to move.
+void sobol_sequence::attach(const sobol_sequence &master)
+{
+	assert(master.tables);
+	set_dim(master.dim);
+	set_tables(master.tables);
+	isScrambled = master.isScrambled;
+	seek(0);
+}
+
+//v[k] = m_k 2^(SOBOL_BITS - 1 - k) for k < s, then the recurrence of
+//the primitive polynomial x^s + a_1 x^(s-1) + ... + a_(s-1) x + 1.
+void sobol_sequence::set_direction_numbers()
+{
+	const unsigned short *jk = sobol_joe_kuo;
+	for(uint16 i = 0; i < dim; i++)
+	{
+		uint64 *vi = v + i * SOBOL_BITS;
+		if(i == 0)
+		{
+			for(uint16 k = 0; k < SOBOL_BITS; k++)
+				vi[k] = 1ULL << (SOBOL_BITS - 1 - k);
+			continue;
+		}
+
+		uint16 s = *jk++;
+		uint32 a = *jk++;
+		for(uint16 k = 0; k < s; k++)
+			vi[k] = (uint64)*jk++ << (SOBOL_BITS - 1 - k);
+		for(uint16 k = s; k < SOBOL_BITS; k++)
+		{
+			vi[k] = vi[k - s] ^ (vi[k - s] >> s);
+			for(uint16 j = 1; j < s; j++)
+				if((a >> (s - 1 - j)) & 1)
+					vi[k] ^= vi[k - j];
+		}
+	}
+}
+
+//Linear matrix scramble: bit r (from the most significant) of each
+//direction number becomes the parity of the bits c <= r selected by
+//row r of a random lower triangular matrix with unit diagonal.  Then a
+//random digital shift, XORed into every point.
+void sobol_sequence::scramble()
+{
+	const uint64 all = (1ULL << SOBOL_BITS) - 1;
+	uint64 row[SOBOL_BITS];
+	for(uint16 i = 0; i < dim; i++)
+	{
+		for(uint16 r = 0; r < SOBOL_BITS; r++)
+		{
+			uint64 above = all & ~((1ULL << (SOBOL_BITS - r)) - 1);
+			row[r] = (pgR64->genrand64_int64() & above)
+				| (1ULL << (SOBOL_BITS - 1 - r));
+		}
+
+		uint64 *vi = v + i * SOBOL_BITS;
+		for(uint16 k = 0; k < SOBOL_BITS; k++)
+		{
+			uint64 scrambled = 0;
+			for(uint16 r = 0; r < SOBOL_BITS; r++)
+				if(__builtin_parityll(vi[k] & row[r]))
+					scrambled |= 1ULL << (SOBOL_BITS - 1 - r);
+			vi[k] = scrambled;
+		}
+		shift[i] = pgR64->genrand64_int64() & all;
+	}
+}
+
+//Coordinate i of point n: the direction numbers of the bits of the
+//Gray code of n.  O(log n).
+uint64 sobol_sequence::point(uint16 i, uint64 n)
+{
+	const uint64 *vi = v + i * SOBOL_BITS;
+	uint64 xi = shift[i];
+	for(uint64 g = n ^ (n >> 1); g; g &= g - 1)
+		xi ^= vi[__builtin_ctzll(g)];
+	return xi;
+}
+
+//Positions the sequence so that the next genSobol() gives point n;
+//seek(0) is where init() leaves it.
+void sobol_sequence::seek(uint64 n)
+{
+	for(uint16 i = 0; i < dim; i++)
+	{
+		x[i] = n > 0 ? point(i, n - 1) : 0;
+		next[i] = n;
+	}
+}
+
+//Makes point n current, as seek(n) followed by genSobol() would.
+void sobol_sequence::genSobolAt(uint64 n)
+{
+	for(uint16 i = 0; i < dim; i++)
+	{
+		x[i] = point(i, n);
+		next[i] = n + 1;
+	}
+}
+
+//Point n differs from point n - 1 in the direction number of the
+//lowest set bit of n.
+void sobol_sequence::genSobol()
+{
+	for(uint16 i = 0; i < dim; i++)
+	{
+		uint64 n = next[i]++;
+		if(n == 0)
+			x[i] = shift[i];
+		else
+			x[i] ^= v[i * SOBOL_BITS + __builtin_ctzll(n)];
+	}
+}
+
+//Generates the next B points, as B calls of genSobol() would, writing
+//coordinate d of point b to out[(d - 1) * stride + b].
+void sobol_sequence::genSobolBlock(uint32 B, real *out, uint32 stride)
+{
+	genSobolBlock(1, dim, B, out, stride);
+}
+
+//As above for coordinates d0..d0 + count - 1 only, coordinate d going
+//to out[(d - d0) * stride + b]; as for halton::genHaltonBlock, every
+//coordinate must be advanced by the same B before genSobol() or
+//get_rnd() are used again.
+void sobol_sequence::genSobolBlock(uint16 d0, uint16 count, uint32 B,
+				   real *out, uint32 stride)
+{
+	for(uint16 i = d0 - 1; i < d0 - 1 + count; i++)
+	{
+		real *col = out + (i - d0 + 1) * stride;
+		const uint64 *vi = v + i * SOBOL_BITS;
+		uint64 xi = x[i], n = next[i];
+		uint32 b = 0;
+		if(n == 0 && B > 0)
+		{
+			xi = shift[i];
+			col[b++] = to_unit(xi);
+			n++;
+		}
+		for(; b < B; b++, n++)
+		{
+			xi ^= vi[__builtin_ctzll(n)];
+			col[b] = to_unit(xi);
+		}
+		x[i] = xi;
+		next[i] = n;
+	}
+}
+
+real sobol_sequence::get_rnd(uint16 d)
+{
+	return to_unit(x[d - 1]);
+}
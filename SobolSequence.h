@@ -0,0 +1,98 @@
+/* 
+   Scrambled Sobol' sequence, an alternative to the RASRAP Halton
+   sequence of Halton.h with the same interface: init(), attach() for
+   workers, seek(), point-at-a-time & structure-of-arrays block
+   generation and get_rnd().
+
+   Points are generated in Gray-code order, so moving to the next point
+   XORs one direction number into each coordinate.  The direction
+   numbers are those of Joe & Kuo (SobolDirections.cpp), randomized by
+   a linear matrix scramble & a digital shift (Matousek, 1998), which
+   keeps the (t,s)-net structure.  A coordinate holds SOBOL_BITS bits
+   and is returned as the centre of its cell, so points are in (0,1)
+   and never 0, which the inverse normal could not take.
+
+   References:
+   Joe, S., & Kuo, F. Y., Constructing Sobol sequences with better
+   two-dimensional projections.  SIAM Journal on Scientific Computing,
+   2008, Vol 30, No 5, 2635--2654.
+
+   Matousek, J., On the L2-discrepancy for anchored boxes.  Journal of
+   Complexity, 1998, Vol 14, No 4, 527--556.
+*/
+
+#ifndef _SOBOLSEQUENCE_H
+#define _SOBOLSEQUENCE_H
+
+#include <memory>
+#include "Halton.h"
+
+#define SOBOL_DIM 1000		//Dimensions with direction numbers
+#define SOBOL_BITS 52		//Bits per coordinate, at most 2^SOBOL_BITS points
+
+//s, a, m_1..m_s of dimensions 2..SOBOL_DIM, see SobolDirections.cpp
+extern const unsigned short sobol_joe_kuo[];
+
+//Direction numbers & digital shifts of one (scrambled) sequence.  A
+//master's init() builds them and nothing changes them after, as for
+//halton_tables.
+struct sobol_tables
+{
+	sobol_tables(uint16 d);
+	~sobol_tables();
+
+	uint16 dim;
+	uint64 *v;		//v[i * SOBOL_BITS + k]: direction number k of coordinate i
+	uint64 *shift;		//shift[i]: digital shift of coordinate i, 0 if unscrambled
+
+private:
+	sobol_tables(const sobol_tables&);
+	sobol_tables& operator=(const sobol_tables&);
+};
+
+//Masters & workers as in halton: a master draws its scramble in init(),
+//from the process-wide genRand_64 or its own if set_seed() was called;
+//a worker, sobol_sequence(false), is attach()ed to a master.
+class sobol_sequence
+{
+public:
+	sobol_sequence(bool isMaster = true);
+	~sobol_sequence();
+	void init(uint16 dim, bool scramble);
+	void attach(const sobol_sequence &master);
+	void set_seed(uint64 seed);
+
+	void genSobol();
+	void genSobolBlock(uint32 B, real *out, uint32 stride);
+	void genSobolBlock(uint16 d0, uint16 count, uint32 B, real *out,
+			   uint32 stride);
+	void seek(uint64 n);
+	void genSobolAt(uint64 n);
+
+	real get_rnd(uint16 d);
+	uint16 get_dim(){return dim;}
+
+private:
+	uint16 dim;
+	uint64 *x;		//x[i]: bits of coordinate i of the current point
+	uint64 *next;		//next[i]: number of the next point of coordinate i
+	//Shared read-only tables & shortcuts to their arrays
+	std::shared_ptr<sobol_tables> tables;
+	uint64 *v;
+	uint64 *shift;
+	genRand_64 *pgR64;//Pseudorandom number generator handler
+	genRand_64 *ownRNG;//pgR64 if set_seed() was called, else NULL
+	bool isScrambled;
+	bool isMasterThread;
+
+	void set_dim(uint16 d);
+	void set_tables(const std::shared_ptr<sobol_tables> &t);
+	void set_direction_numbers();
+	void scramble();
+	uint64 point(uint16 i, uint64 n);
+
+	sobol_sequence(const sobol_sequence&);
+	sobol_sequence& operator=(const sobol_sequence&);
+};
+
+#endif
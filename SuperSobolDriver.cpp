@@ -133,6 +133,15 @@ int main(int argc, char** argv)
 			       initialDistroParams,
 			       paramUncertaintyDistroParams,dim,N_MC,
 			       N_Super_Sobol);
+  // // distribute the outer loop over all cores
+  // superSobol.SetNumThreads(std::thread::hardware_concurrency());
+
+  // // reuse standard-normal draws across the four inner computations
+  // superSobol.SetSampleBankMode(BANK_PER_ITERATION);
+
+  // // evaluate the model once, reweight for every outer draw
+  // superSobol.SetReweighting(true);
+
   /* print member of SobolIndices object for verification */
   superSobol.DisplayMembers();
 
@@ -1,4 +1,6 @@
 #include "SuperSobolIndices.h"
+#include <thread>
+#include <atomic>
 
 /* Ctor
  * Input:
@@ -14,6 +16,8 @@
  * N_MC_ = number of Monte Carlo runs to compute Sobol indices
  * N_Super_Sobol_ = number of Monte Carlo runs to compute Super Sobol
  *    indices
+ * sampler_ = sequence of both the outer (uncertainty) and inner
+ *    (parameter) points, defaulted to the RASRAP Halton sequence
  */
 SuperSobolIndices::
 SuperSobolIndices(Type (*model_)(const std::vector<Type>&, 
@@ -26,7 +30,8 @@ SuperSobolIndices(Type (*model_)(const std::vector<Type>&,
 		  &paramUncertaintyDistroParams_,
 		  const unsigned int dim_,
 		  const unsigned int N_MC_,
-		  const unsigned int N_Super_Sobol_)
+		  const unsigned int N_Super_Sobol_,
+		  SamplerType sampler_)
 {
   // model = model_;
   // constants = constants_;
@@ -36,26 +41,276 @@ SuperSobolIndices(Type (*model_)(const std::vector<Type>&,
   dim = dim_;
   N_Super_Sobol = N_Super_Sobol_;
 
+  // construct SobolIndices object
+  master.sobol = new SobolIndices(model_, constants_, indices, 
+				  initialDistroParams_, dim, N_MC_, 1.0,
+				  sampler_);
+
+  Initialize(sampler_);
+}
+
+/* Ctor for a vector-valued model of numOutputs_ outputs (see
+ * VectorModel in SobolIndices.h): one outer loop computes the Super
+ * Sobol' indices of every output, see GetLowerSuperIndices() etc.
+ * Remaining inputs are as for the scalar-model ctor.
+ */
+SuperSobolIndices::
+SuperSobolIndices(VectorModel vectorModel_,
+		  unsigned int numOutputs_,
+		  const std::vector<Type> &constants_,
+		  const std::set<int> &indices_,
+		  const std::vector<std::vector<Type> >
+		  &initialDistroParams_,
+		  const std::vector<std::vector<Type> >
+		  &paramUncertaintyDistroParams_,
+		  const unsigned int dim_,
+		  const unsigned int N_MC_,
+		  const unsigned int N_Super_Sobol_,
+		  SamplerType sampler_)
+{
+  indices = indices_;
+  paramUncertaintyDistroParams = paramUncertaintyDistroParams_;
+  dim = dim_;
+  N_Super_Sobol = N_Super_Sobol_;
+
+  master.sobol = new SobolIndices(vectorModel_, numOutputs_, constants_,
+				  indices, initialDistroParams_, dim,
+				  N_MC_, 1.0, sampler_);
+
+  Initialize(sampler_);
+}
+
+/* Ctor for a batch model of numOutputs_ outputs (see BatchModel in
+ * SobolIndices.h).  Remaining inputs are as for the scalar-model
+ * ctor.
+ */
+SuperSobolIndices::
+SuperSobolIndices(BatchModel batchModel_,
+		  unsigned int numOutputs_,
+		  const std::vector<Type> &constants_,
+		  const std::set<int> &indices_,
+		  const std::vector<std::vector<Type> >
+		  &initialDistroParams_,
+		  const std::vector<std::vector<Type> >
+		  &paramUncertaintyDistroParams_,
+		  const unsigned int dim_,
+		  const unsigned int N_MC_,
+		  const unsigned int N_Super_Sobol_,
+		  SamplerType sampler_)
+{
+  indices = indices_;
+  paramUncertaintyDistroParams = paramUncertaintyDistroParams_;
+  dim = dim_;
+  N_Super_Sobol = N_Super_Sobol_;
+
+  master.sobol = new SobolIndices(batchModel_, numOutputs_, constants_,
+				  indices, initialDistroParams_, dim,
+				  N_MC_, 256, 1.0, sampler_);
+
+  Initialize(sampler_);
+}
+
+/* Work shared by the ctors once master.sobol is constructed */
+void SuperSobolIndices::Initialize(SamplerType sampler_)
+{
+  numOutputs = master.sobol->GetNumOutputs();
+
   // intialize Super Sobol indices
   lowerSuperIndex = 0;
   totalSuperIndex = 0;
+  superModelMean = 0;
+  superModelVariance = 0;
+  lowerSuperIndices.assign(numOutputs, 0);
+  totalSuperIndices.assign(numOutputs, 0);
+  superModelMeans.assign(numOutputs, 0);
+  superModelVariances.assign(numOutputs, 0);
 
   // allocate model argument vectors
-  s1.resize(dim);
-  s2.resize(dim);
-  s_arg1.resize(dim);
-  s_arg2.resize(dim);
+  AllocateWorker(master);
 
-  // construct halton (RASRAP) & InverseTransformation objects
-  RNG = new halton();
+  // construct generator of 2*dim-coordinate points (s1 & s2) &
+  // InverseTransformation objects
+  master.RNG = SampleGenerator::New(sampler_, 2*dim);
   invTrans = new InverseTransformation();
 
-  // construct SobolIndices object
-  sobol = new SobolIndices(model_, constants_, indices, 
-			   initialDistroParams_, dim, N_MC_);
+  // no outer samples drawn yet
+  outerOffset = 0;
+
+  // serial until SetNumThreads() is called
+  numThreads = 0;
+  chunkSize = 16;
+
+  bankMode = BANK_NONE;
+  isReweighted = false;
+}
+
+/* Sizes the uncertainty & inner-result vectors of w */
+void SuperSobolIndices::AllocateWorker(SuperSobolWorker &w)
+{
+  w.s1.resize(dim);
+  w.s2.resize(dim);
+  w.s_arg1.resize(dim);
+  w.s_arg2.resize(dim);
+  w.F.resize(numOutputs);
+  w.F2.resize(numOutputs);
+  w.F_model1.resize(numOutputs);
+  w.F_model2.resize(numOutputs);
+}
+
+/* Switches ComputeSuperSobolIndices() to a parallel outer loop.  The
+ * N_Super_Sobol outer iterations are cut into chunks of chunkSize_;
+ * the threads take chunks in turn, each with its own copy of the
+ * SobolIndices object and its own outer generator.  Outer iteration i
+ * always uses outer point i and the same 4*N_MC inner points as in
+ * the serial loop, and the chunk sums are merged in chunk order, so
+ * the results are bitwise identical for any numThreads_ >= 1.
+ *
+ * The model must be safe to call from several threads at once.
+ */
+void SuperSobolIndices::
+SetNumThreads(unsigned int numThreads_, unsigned int chunkSize_)
+{
+  DeleteWorkers();
+
+  numThreads = numThreads_;
+  chunkSize = chunkSize_ > 0 ? chunkSize_ : 1;
+
+  workers.resize(numThreads);
+  for (unsigned int t = 0; t < numThreads; ++t)
+    {
+      SuperSobolWorker &w = workers[t];
+      w.sobol = new SobolIndices(*master.sobol);
+
+      // same sequence as the master's, own position
+      w.RNG = master.RNG->Clone();
+
+      AllocateWorker(w);
+    }
+}
+
+/* Selects how the inner Sobol' computations get their samples.  Only
+ * the variances change between the four inner computations of an
+ * outer iteration, and x = mean + sqrt(var)*z, so the standard-normal
+ * z's can be drawn once and rescaled:
+ *   BANK_NONE = each inner computation draws N_MC new points
+ *     (the original scheme),
+ *   BANK_SHARED = one bank of N_MC points, drawn at the next
+ *     ComputeSuperSobolIndices(), used by every inner computation,
+ *   BANK_PER_ITERATION = each outer iteration draws N_MC points used
+ *     by its four inner computations (common random numbers, which
+ *     lowers the variance of F_model1 - F2 and F - F_model2).
+ * The inner computations then skip the point generation & inverse
+ * transformation.
+ */
+void SuperSobolIndices::SetSampleBankMode(SampleBankMode mode)
+{
+  bankMode = mode;
+
+  master.sobol->ClearSampleBank();
+  for (size_t t = 0; t < workers.size(); ++t)
+    {
+      workers[t].sobol->ClearSampleBank();
+    }
+}
+
+/* Selects the inverse normal CDF approximation of the inner Sobol'
+ * computations, see InverseTransformation.h */
+void SuperSobolIndices::SetInverseNormalMethod(InverseNormalMethod method)
+{
+  master.sobol->SetInverseNormalMethod(method);
+  for (size_t t = 0; t < workers.size(); ++t)
+    {
+      workers[t].sobol->SetInverseNormalMethod(method);
+    }
+}
+
+/* Sets the distribution of each model parameter of the inner Sobol'
+ * computations, see SobolIndices::SetDistributions(); a rejected
+ * vector leaves every inner computation as it was & returns false.
+ * The outer loop draws the variances of the normal & lognormal params
+ * (of log x). */
+bool SuperSobolIndices::
+SetDistributions(const std::vector<ParameterDistribution> &distros)
+{
+  if (!master.sobol->SetDistributions(distros))
+    return false;
+  for (size_t t = 0; t < workers.size(); ++t)
+    {
+      workers[t].sobol->SetDistributions(distros);
+    }
+  return true;
+}
 
-  // init RNG: length of Halton vector, random start, random permute
-  RNG->init(2*dim,true,true);
+/* Sets the correlation of the model params of the inner Sobol'
+ * computations, see SobolIndices::SetCorrelation(); a rejected matrix
+ * leaves every inner computation as it was & returns false.  The
+ * reweighted inner estimates need independent params, so a
+ * correlation switches back to the original estimator. */
+bool SuperSobolIndices::
+SetCorrelation(const std::vector<std::vector<Type> > &correlation)
+{
+  if (!master.sobol->SetCorrelation(correlation))
+    return false;
+  for (size_t t = 0; t < workers.size(); ++t)
+    {
+      workers[t].sobol->SetCorrelation(correlation);
+    }
+  if (isReweighted && !correlation.empty())
+    {
+      std::cerr << "SuperSobolIndices::SetCorrelation: reweighting "
+		<< "needs independent params, switched off\n";
+      SetReweighting(false);
+    }
+  return true;
+}
+
+/* Switches the inner estimator to importance reweighting.  The model
+ * is evaluated once, here, on N_MC samples at the reference variances;
+ * each inner Sobol' index is then estimated from those evaluations
+ * with likelihood-ratio weights (see
+ * SobolIndices::ComputeReweightedSensitivityIndices()), so the outer
+ * loop costs no model evaluations.  The min & mean effective sample
+ * size over the inner estimates are reported by DisplayMembers(); a
+ * small min means the reference design covers some outer draws
+ * poorly and N_MC should be raised.  The design needs independent
+ * normal params (see SobolIndices::EvaluateReferenceDesign());
+ * otherwise the original estimator is kept.
+ *
+ * Input:
+ *   reweight = true to reweight, false for the original estimator
+ *   referenceVariances = variances of the reference design, defaulted
+ *       to the upper ends of the uncertainty distros so that every
+ *       weight is bounded
+ */
+void SuperSobolIndices::
+SetReweighting(bool reweight, const std::vector<Type> &referenceVariances)
+{
+  isReweighted = reweight;
+  if (!isReweighted)
+    return;
+
+  std::vector<Type> variances = referenceVariances;
+  if (variances.empty())
+    {
+      for (int j = 0; j < dim; ++j)
+	{
+	  variances.push_back(paramUncertaintyDistroParams[j][1]);
+	}
+    }
+  /* stays with the original estimator if the design is refused */
+  master.sobol->SetReferenceDesign(std::shared_ptr<ReferenceDesign>());
+  master.sobol->EvaluateReferenceDesign(variances);
+  isReweighted = (bool)master.sobol->GetReferenceDesign();
+}
+
+void SuperSobolIndices::DeleteWorkers()
+{
+  for (size_t t = 0; t < workers.size(); ++t)
+    {
+      delete workers[t].sobol;
+      delete workers[t].RNG;
+    }
+  workers.clear();
 }
 
 /* Displays member variables of the SobolIndices class */
@@ -68,6 +323,19 @@ void SuperSobolIndices::DisplayMembers()
   std::cout << "totalSuperIndex: " << totalSuperIndex << "\n";
   std::cout << "superModelVariance: " << superModelVariance << "\n";
   std::cout << "superModelMean: " << superModelMean << "\n";
+  if (numOutputs > 1)
+    {
+      std::cout << "lowerSuperIndices, totalSuperIndices: \n";
+      DisplayVector(std::vector<std::vector<Type> >
+		    {lowerSuperIndices, totalSuperIndices});
+    }
+  if (isReweighted)
+    {
+      std::cout << "min effective sample size: "
+		<< GetMinEffectiveSampleSize() << "\n";
+      std::cout << "mean effective sample size: "
+		<< GetMeanEffectiveSampleSize() << "\n";
+    }
   std::cout << "indices: \n";
   DisplaySet(indices);
   std::cout << "paramUncertaintyDistroParams: \n";
@@ -89,64 +357,188 @@ void SuperSobolIndices::
 ComputeSuperSobolIndices()
 {
   // MC accumulators
-  Type f0_sum_super = 0, Dy_sum_super = 0, DT_sum_super = 0, 
-    D_sum_super = 0;
+  SobolAccumulator acc(numOutputs);
+  essStats = EffectiveSampleSizeStats();
 
-  // model evaluations
-  Type F, F2, F_model1, F_model2;
+  if (bankMode == BANK_SHARED && !master.sobol->GetSampleBank())
+    {
+      master.sobol->GenerateSampleBank();
+    }
+
+  if (numThreads > 0)
+    {
+      AccumulateChunks(acc);
+    }
+  else
+    {
+      for (unsigned int i = 0; i < N_Super_Sobol; ++i)
+	{
+	  // std::cout << i << "\n";
+	  AccumulateOuterSample(master, acc, essStats);
+	}
+      outerOffset += N_Super_Sobol;
+    }
 
-  for (unsigned int i = 0; i < N_Super_Sobol; ++i)
+  // compute Super Sobol indices
+  for (unsigned int k = 0; k < numOutputs; ++k)
     {
-      // std::cout << i << "\n";
-      // generate 2*dim random numbers
-      RNG->genHalton();
+      superModelMeans[k] = acc.fMean[k];
+      superModelVariances[k] = acc.Variance(acc.fM2[k]);
 
-      // transform each random number to parameter uncertainty distro
-      TransformToParamUncertaintyDomain();
+      Type Dy_super = acc.DyMean[k];
+      Type DT_super = acc.DTMean[k];
 
-      /* assign xformed RVs to proper model argument vectors, will now
-       * have uncertainties for each parameter */
-      AssignUncertaintyModelArguments();
+      /* printed once, for output 0 */
+      if (k == 0)
+	{
+	  std::cout << "Dy_super = " << Dy_super << "\n";
+	  std::cout << "DT_super = " << DT_super << "\n";
+	}
 
-      // compute Sobol index for given uncertainties
-      F = sobol->ComputeSensitivityIndices(s1);
-      F2 = sobol->ComputeSensitivityIndices(s2);
-      F_model1 = sobol->ComputeSensitivityIndices(s_arg1);
-      F_model2 = sobol->ComputeSensitivityIndices(s_arg2);
+      //  /* normalized */
+      // lowerIndex = Dy_super/superModelVariance;
+      // totalIndex = DT_super/(2.0*superModelVariance);
 
-      // MC accumulations for Super Sobol indices
-      f0_sum_super += F;
-      D_sum_super += F*F;
-      Dy_sum_super += F*(F_model1 - F2); 
-      DT_sum_super += pow((F - F_model2), 2.0);
+      /* non-normalized */
+      lowerSuperIndices[k] = Dy_super;
+      totalSuperIndices[k] = DT_super/2.0;
     }
 
-  // compute Super Sobol indices
-  superModelMean = f0_sum_super/N_Super_Sobol;
-  superModelVariance = D_sum_super/N_Super_Sobol 
-    - superModelMean*superModelMean;
+  superModelMean = superModelMeans[0];
+  superModelVariance = superModelVariances[0];
+  lowerSuperIndex = lowerSuperIndices[0];
+  totalSuperIndex = totalSuperIndices[0];
+}
 
-  Type Dy_super = Dy_sum_super/N_Super_Sobol;
-  Type DT_super = DT_sum_super/N_Super_Sobol;
+/* One outer iteration: draws the next uncertainties from w.RNG,
+ * computes the four inner Sobol' indices with w.sobol and adds them
+ * to the outer sums.
+ */
+void SuperSobolIndices::
+AccumulateOuterSample(SuperSobolWorker &w, SobolAccumulator &acc,
+		      EffectiveSampleSizeStats &ess)
+{
+  // generate 2*dim random numbers, Unif(0,1) in s1 & s2
+  w.RNG->Generate(1, dim, 1, w.s1.data(), 1);
+  w.RNG->Generate(dim+1, dim, 1, w.s2.data(), 1);
+
+  // common random numbers for the four inner computations
+  if (bankMode == BANK_PER_ITERATION && !isReweighted)
+    {
+      w.sobol->GenerateSampleBank();
+    }
+
+  // transform each random number to parameter uncertainty distro
+  TransformToParamUncertaintyDomain(w);
+
+  /* assign xformed RVs to proper model argument vectors, will now
+   * have uncertainties for each parameter */
+  AssignUncertaintyModelArguments(w);
+
+  // compute Sobol index for given uncertainties
+  const std::vector<Type> *uncertainties[4]
+    = {&w.s1, &w.s2, &w.s_arg1, &w.s_arg2};
+  std::vector<Type> *results[4] = {&w.F, &w.F2, &w.F_model1, &w.F_model2};
+  for (int r = 0; r < 4; ++r)
+    {
+      if (isReweighted)
+	{
+	  w.sobol->ComputeReweightedSensitivityIndices(*uncertainties[r]);
+	  ess.Add(w.sobol->GetEffectiveSampleSize());
+	}
+      else
+	{
+	  w.sobol->ComputeSensitivityIndices(*uncertainties[r]);
+	}
+      *results[r] = w.sobol->GetOutputTotalIndices();
+    }
+
+  // MC accumulations for Super Sobol indices, one column per output
+  acc.Add(w.F.data(), w.F2.data(), 1, w.F_model1.data(),
+	  w.F_model2.data(), 1, 1);
+}
+
+/* Parallel outer loop, see SetNumThreads().  Leaves the master's
+ * outer and inner generators after the points it consumed, as the
+ * serial loop does.
+ */
+void SuperSobolIndices::AccumulateChunks(SobolAccumulator &acc)
+{
+  unsigned int numChunks = (N_Super_Sobol + chunkSize - 1)/chunkSize;
+  std::vector<SobolAccumulator> chunkAcc(numChunks,
+					 SobolAccumulator(numOutputs));
+  std::vector<EffectiveSampleSizeStats> chunkEss(numChunks);
+  std::atomic<unsigned int> nextChunk(0);
+
+  // inner points used by one outer iteration
+  uint64 innerBase = master.sobol->GetSampleOffset();
+  uint64 innerStride = 4*(uint64)master.sobol->GetN_MC();
+  if (bankMode == BANK_SHARED || isReweighted)
+    {
+      innerStride = 0;
+    }
+  else if (bankMode == BANK_PER_ITERATION)
+    {
+      innerStride = master.sobol->GetN_MC();
+    }
+
+  for (unsigned int t = 0; t < workers.size(); ++t)
+    {
+      workers[t].sobol->SetSampleBank(bankMode == BANK_SHARED ?
+				      master.sobol->GetSampleBank() :
+				      std::shared_ptr<NormalSampleBank>());
+      workers[t].sobol->SetReferenceDesign(master.sobol
+					   ->GetReferenceDesign());
+    }
+
+  // each thread takes the next unclaimed chunk until none are left
+  auto work = [&](unsigned int t)
+    {
+      SuperSobolWorker &w = workers[t];
+      unsigned int c;
+      while ((c = nextChunk++) < numChunks)
+	{
+	  unsigned int first = c*chunkSize;
+	  unsigned int last = std::min(first + chunkSize, N_Super_Sobol);
+	  w.RNG->Seek(outerOffset + first);
+	  w.sobol->SetSampleOffset(innerBase + first*innerStride);
+	  for (unsigned int i = first; i < last; ++i)
+	    {
+	      AccumulateOuterSample(w, chunkAcc[c], chunkEss[c]);
+	    }
+	}
+    };
 
-  std::cout << "Dy_super = " << Dy_super << "\n";
-  std::cout << "DT_super = " << DT_super << "\n";
+  unsigned int T = std::min(numThreads, numChunks);
+  std::vector<std::thread> threads;
+  for (unsigned int t = 1; t < T; ++t)
+    {
+      threads.push_back(std::thread(work, t));
+    }
+  work(0);
+  for (size_t t = 0; t < threads.size(); ++t)
+    {
+      threads[t].join();
+    }
 
-  //  /* normalized */
-  // lowerIndex = Dy_super/superModelVariance;
-  // totalIndex = DT_super/(2.0*superModelVariance);
+  // fixed merge order makes the sums independent of thread count
+  for (unsigned int c = 0; c < numChunks; ++c)
+    {
+      acc.Merge(chunkAcc[c]);
+      essStats.Merge(chunkEss[c]);
+    }
 
-  /* non-normalized */
-  lowerSuperIndex = Dy_super;
-  totalSuperIndex = DT_super/2.0;
+  outerOffset += N_Super_Sobol;
+  master.RNG->Seek(outerOffset);
+  master.sobol->SetSampleOffset(innerBase + N_Super_Sobol*innerStride);
 }
 
-/* Fills the s_arg1 and s_arg2 member vectors that hold the 
+/* Fills the s_arg1 and s_arg2 vectors of w that hold the 
  * uncertainties for the corresponding parameters according to the
  * parameter index for which we are computing Super Sobol indices for
  */
 void SuperSobolIndices::
-AssignUncertaintyModelArguments()
+AssignUncertaintyModelArguments(SuperSobolWorker &w)
 {
   for (int j = 0; j < dim; ++j)
     {
@@ -155,37 +547,33 @@ AssignUncertaintyModelArguments()
 
       if (inIndexSet)
 	{
-	  s_arg1[j] = s1[j];
-	  s_arg2[j] = s2[j];
+	  w.s_arg1[j] = w.s1[j];
+	  w.s_arg2[j] = w.s2[j];
 	}
       else
 	{
-	  s_arg1[j] = s2[j];
-	  s_arg2[j] = s1[j];
+	  w.s_arg1[j] = w.s2[j];
+	  w.s_arg2[j] = w.s1[j];
 	}
     }
 }
 
-/* Retrieves the Unif(0,1) random numbers generates in 
- * ComputeSuperSobolIndices() and transforms them to the respective
- * distributions of the uncertainties, s1 and s2.
+/* Transforms the Unif(0,1) random numbers that AccumulateOuterSample()
+ * drew from w.RNG into w.s1 and w.s2 to the respective distributions
+ * of the uncertainties, in place.
  */
 void SuperSobolIndices::
-TransformToParamUncertaintyDomain()
+TransformToParamUncertaintyDomain(SuperSobolWorker &w)
 {
-  // retrieve random numbers computed in ComputeSuperSobolIndices()
   for (int j = 0; j < dim; ++j)
     {
-      s1[j] = RNG->get_rnd(j+1);
-      s2[j] = RNG->get_rnd(j+1+dim);
-
       // left and right endpoints of uniform uncertainty distros
       Type a = paramUncertaintyDistroParams[j][0];
       Type b = paramUncertaintyDistroParams[j][1];
 
       // generate Unif(a,b) RVs from uncertainties
-      s1[j] = invTrans->Uniform(s1[j],a,b);
-      s2[j] = invTrans->Uniform(s2[j],a,b);
+      w.s1[j] = invTrans->Uniform(w.s1[j],a,b);
+      w.s2[j] = invTrans->Uniform(w.s2[j],a,b);
     }
 }
 
@@ -5,25 +5,44 @@
 
 typedef double Type;
 
-class SuperSobolIndices
+/* Reuse of the inner standard-normal draws, see SetSampleBankMode() */
+enum SampleBankMode
 {
- private:
-  SobolIndices *sobol;  // sobol indices object; computes S's
-  halton *RNG;  // random number generator = RASRAP
-  InverseTransformation *invTrans;  // inverse transformation object
-  /* Type (*model)(const std::vector<Type>&, */
-  /* 		const std::vector<Type>&);  // model */
+  BANK_NONE,  // every inner computation draws new points
+  BANK_SHARED,  // one bank of N_MC points for all inner computations
+  BANK_PER_ITERATION  // new bank per outer iteration, shared by its 4
+};
 
-  // distribution of parameter uncertainties
-  std::vector<std::vector<Type> > paramUncertaintyDistroParams;
+/* Effective sample sizes of the reweighted inner estimates, see
+ * SetReweighting() */
+struct EffectiveSampleSizeStats
+{
+  Type min, sum;
+  unsigned long count;
 
-  // number of MC runs to compute Super Sobol indices
-  unsigned int N_Super_Sobol;
-  int dim;  // number of parameters in model
-  std::set<int> indices;  // index set to compute Super Sobol index of
-  /* std::vector<Type> constants;  // model constants, if needed */
-  Type lowerSuperIndex, totalSuperIndex;  // Super Sobol indices
-  Type superModelMean, superModelVariance;  // super model mean & var
+  EffectiveSampleSizeStats() : min(0), sum(0), count(0) {}
+  void Add(Type ess)
+  {
+    min = (count == 0 || ess < min) ? ess : min;
+    sum += ess;
+    ++count;
+  }
+  void Merge(const EffectiveSampleSizeStats &other)
+  {
+    if (other.count == 0)
+      return;
+    min = (count == 0 || other.min < min) ? other.min : min;
+    sum += other.sum;
+    count += other.count;
+  }
+};
+
+/* State of one outer-loop walker: the master (serial loop) or a
+ * thread of the parallel loop */
+struct SuperSobolWorker
+{
+  SobolIndices *sobol;  // sobol indices object; computes S's
+  SampleGenerator *RNG;  // random number generator, RASRAP by default
 
   /* Each element contains the uncertainty for the corresponding
    * parameter on a given run.  E.g. assume a four-parameter model with
@@ -42,6 +61,55 @@ class SuperSobolIndices
 */
   std::vector<Type> s1, s2, s_arg1, s_arg2;
 
+  // inner total indices of each model output at s1, s2, s_arg1, s_arg2
+  std::vector<Type> F, F2, F_model1, F_model2;
+};
+
+class SuperSobolIndices
+{
+ private:
+  SuperSobolWorker master;  // serial loop state, owns sobol & RNG
+  InverseTransformation *invTrans;  // inverse transformation object
+  /* Type (*model)(const std::vector<Type>&, */
+  /* 		const std::vector<Type>&);  // model */
+
+  // distribution of parameter uncertainties
+  std::vector<std::vector<Type> > paramUncertaintyDistroParams;
+
+  // number of MC runs to compute Super Sobol indices
+  unsigned int N_Super_Sobol;
+  int dim;  // number of parameters in model
+  std::set<int> indices;  // index set to compute Super Sobol index of
+  /* std::vector<Type> constants;  // model constants, if needed */
+  Type lowerSuperIndex, totalSuperIndex;  // Super Sobol indices
+  Type superModelMean, superModelVariance;  // super model mean & var
+  unsigned int numOutputs;  // K, number of model outputs
+  // the above of each model output; the scalars are for output 0
+  std::vector<Type> lowerSuperIndices, totalSuperIndices;
+  std::vector<Type> superModelMeans, superModelVariances;
+
+  // position of the outer loop in RNG's sequence, see SobolIndices
+  uint64 outerOffset;
+
+  // parallel outer loop, see SetNumThreads(); numThreads = 0 is serial
+  unsigned int numThreads;
+  unsigned int chunkSize;  // outer iterations per summed chunk
+  std::vector<SuperSobolWorker> workers;
+
+  SampleBankMode bankMode;  // reuse of inner draws
+
+  // reweight one reference design instead of evaluating the model
+  bool isReweighted;
+  EffectiveSampleSizeStats essStats;  // of the last computation
+
+  void AccumulateOuterSample(SuperSobolWorker &w,
+			     SobolAccumulator &acc,
+			     EffectiveSampleSizeStats &ess);
+  void AccumulateChunks(SobolAccumulator &acc);
+  void DeleteWorkers();
+  void Initialize(SamplerType sampler_);
+  void AllocateWorker(SuperSobolWorker &w);
+
 
  public:
   SuperSobolIndices(Type (*model_)(const std::vector<Type>&, 
@@ -54,10 +122,53 @@ class SuperSobolIndices
 		    &paramUncertaintyDistroParams_,
 		    const unsigned int dim_,
 		    const unsigned int N_MC_,
-		    const unsigned int N_Super_Sobol_);
+		    const unsigned int N_Super_Sobol_,
+		    SamplerType sampler_ = SAMPLER_HALTON);
+  SuperSobolIndices(VectorModel vectorModel_,
+		    unsigned int numOutputs_,
+		    const std::vector<Type> &constants_,
+		    const std::set<int> &indices_,
+		    const std::vector<std::vector<Type> >
+		    &initialDistroParams_,
+		    const std::vector<std::vector<Type> >
+		    &paramUncertaintyDistroParams_,
+		    const unsigned int dim_,
+		    const unsigned int N_MC_,
+		    const unsigned int N_Super_Sobol_,
+		    SamplerType sampler_ = SAMPLER_HALTON);
+  SuperSobolIndices(BatchModel batchModel_,
+		    unsigned int numOutputs_,
+		    const std::vector<Type> &constants_,
+		    const std::set<int> &indices_,
+		    const std::vector<std::vector<Type> >
+		    &initialDistroParams_,
+		    const std::vector<std::vector<Type> >
+		    &paramUncertaintyDistroParams_,
+		    const unsigned int dim_,
+		    const unsigned int N_MC_,
+		    const unsigned int N_Super_Sobol_,
+		    SamplerType sampler_ = SAMPLER_HALTON);
   void ComputeSuperSobolIndices();
-  void TransformToParamUncertaintyDomain();
-  void AssignUncertaintyModelArguments();
+  void SetNumThreads(unsigned int numThreads_,
+		     unsigned int chunkSize_ = 16);
+  void SetSampleBankMode(SampleBankMode mode);
+  void SetInverseNormalMethod(InverseNormalMethod method);
+  bool SetDistributions(const std::vector<ParameterDistribution>
+			&distros);
+  bool SetCorrelation(const std::vector<std::vector<Type> >
+		      &correlation);
+  void SetReweighting(bool reweight,
+		      const std::vector<Type> &referenceVariances
+		      = std::vector<Type>());
+  const std::vector<Type>& GetLowerSuperIndices()
+    {return lowerSuperIndices;}
+  const std::vector<Type>& GetTotalSuperIndices()
+    {return totalSuperIndices;}
+  Type GetMinEffectiveSampleSize() {return essStats.min;}
+  Type GetMeanEffectiveSampleSize()
+  {return essStats.count ? essStats.sum/essStats.count : 0;}
+  void TransformToParamUncertaintyDomain(SuperSobolWorker &w);
+  void AssignUncertaintyModelArguments(SuperSobolWorker &w);
 
   /* void ChangeParameterUncertainty(); */
   void DisplayVector(const std::vector<std::vector<Type> > &vec);
@@ -65,9 +176,13 @@ class SuperSobolIndices
   void DisplaySet(const std::set<int> &s);
   ~SuperSobolIndices()
     {
-      delete RNG;
+      DeleteWorkers();
+      delete master.RNG;
       delete invTrans;
-      delete sobol;
+      delete master.sobol;
     }
+  /* the workers own their SobolIndices & generators, so no copies */
+  SuperSobolIndices(const SuperSobolIndices &other) = delete;
+  SuperSobolIndices &operator=(const SuperSobolIndices &other) = delete;
 };
 #endif
@@ -0,0 +1,265 @@
+#include "TabulatedInverseCDF.h"
+#include <algorithm>
+#include <iostream>
+
+/* intervals are halved at most this often, down to 2^-120 of the
+ * initial knot spacing, which reaches far into poles at the ends, and
+ * not below a relative width of 1e-13, where the quadrature nodes
+ * would round onto the ends */
+static const int MAX_DEPTH = 120;
+
+static inline bool Splittable(Type a, Type b)
+{
+  return b - a > 1e-13*std::max(std::abs(a), std::abs(b));
+}
+
+/* 5-point Gauss-Legendre rule on [a,b]; does not evaluate the ends,
+ * where the density may be infinite */
+static Type GaussLegendre5(const TabulatedInverseCDF::Density &pdf,
+			   Type a, Type b)
+{
+  static const Type x[3] = {0.0, 0.5384693101056831, 0.9061798459386640};
+  static const Type w[3] = {0.5688888888888889, 0.4786286704993665,
+			    0.2369268850561891};
+  Type mid = 0.5*(a + b), half = 0.5*(b - a);
+  Type sum = w[0]*pdf(mid);
+  for (int i = 1; i < 3; ++i)
+    {
+      sum += w[i]*(pdf(mid - half*x[i]) + pdf(mid + half*x[i]));
+    }
+  return half*sum;
+}
+
+/* Integral of the density over [a,b], halving where the two halves
+ * disagree with the whole by more than tol.  tol is not halved with
+ * the pieces: near a pole the density is evaluated at 1-x with few
+ * digits, and its noise would never let the halves agree. */
+static Type Integrate(const TabulatedInverseCDF::Density &pdf, Type a,
+		      Type b, Type whole, Type tol, int depth)
+{
+  Type mid = 0.5*(a + b);
+  Type left = GaussLegendre5(pdf, a, mid);
+  Type right = GaussLegendre5(pdf, mid, b);
+  Type error = std::abs(left + right - whole);
+  if (depth >= 40 || error <= tol || error <= 1e-15*(left + right)
+      || !Splittable(a, b))
+    return left + right;
+  return Integrate(pdf, a, mid, left, tol, depth + 1)
+    + Integrate(pdf, mid, b, right, tol, depth + 1);
+}
+
+static Type Integrate(const TabulatedInverseCDF::Density &pdf, Type a,
+		      Type b, Type tol)
+{
+  return Integrate(pdf, a, b, GaussLegendre5(pdf, a, b), tol, 0);
+}
+
+/* Tabulates [x0,x1], whose CDF starts at F0 & density at the ends is
+ * f0, f1, halving it until the u-error is within uTolerance (in the
+ * density's mass units, like F0); returns the CDF at x1 in F1.
+ * Intervals of no mass are left out. */
+void TabulatedInverseCDF::
+AddInterval(const Density &pdf, Type x0, Type x1, Type F0, Type f0,
+	    Type f1, Type uTolerance, int depth, Type &F1)
+{
+  Type mass = Integrate(pdf, x0, x1, 0.01*uTolerance);
+  if (!(mass > 0))
+    {
+      F1 = F0;
+      return;
+    }
+
+  /* slopes dx/du = 1/density relative to the secant, limited so the
+   * cubic is monotone (an end of zero density gives slope 3) */
+  Type h = x1 - x0;
+  Type secant = h/mass;
+  Type a = std::min(1/(f0*secant), 3.0);
+  Type b = std::min(1/(f1*secant), 3.0);
+  if (a*a + b*b > 9)
+    {
+      Type tau = 3/sqrt(a*a + b*b);
+      a *= tau;
+      b *= tau;
+    }
+  /* Hermite cubic in t = (u - F0)/mass */
+  Type s0 = a*h, s1 = b*h;
+  Interval r = {F0, 1/mass, x0, s0, 3*h - 2*s0 - s1, s0 + s1 - 2*h};
+
+  bool accurate = true;
+  for (int q = 1; q <= 3 && depth < MAX_DEPTH && Splittable(x0, x1); ++q)
+    {
+      Type t = 0.25*q;
+      Type x = r.x0 + t*(r.c1 + t*(r.c2 + t*r.c3));
+      Type F = x > x0 ? Integrate(pdf, x0, x, 0.01*uTolerance) : 0;
+      if (std::abs(F - t*mass) > uTolerance)
+	{
+	  accurate = false;
+	  break;
+	}
+    }
+
+  if (accurate)
+    {
+      intervals.push_back(r);
+      F1 = F0 + mass;
+      return;
+    }
+
+  Type xm = 0.5*(x0 + x1), fm = pdf(xm), Fm;
+  AddInterval(pdf, x0, xm, F0, f0, fm, uTolerance, depth + 1, Fm);
+  AddInterval(pdf, xm, x1, Fm, fm, f1, uTolerance, depth + 1, F1);
+}
+
+/* Knots x of the table, in order, out from center to each end of
+ * [lower, upper]: 8 evenly spaced on a finite side, center +-
+ * scale*(2^k - 1) on an infinite one, out to where a piece holds less
+ * than tailTolerance of mass.  Returns the mass of the density over
+ * the knots. */
+static Type PlaceKnots(const TabulatedInverseCDF::Density &pdf,
+		       Type lower, Type upper, Type center, Type scale,
+		       Type tailTolerance, std::vector<Type> &x)
+{
+  const int finiteKnots = 8;  /* knots on a finite side */
+
+  /* knots out from the centre to each end, nearest first */
+  std::vector<Type> knots[2];
+  const Type ends[2] = {lower, upper};
+  Type mass = 0;
+  for (int side = 0; side < 2; ++side)
+    {
+      Type sign = side ? 1 : -1, end = ends[side];
+      Type from = center;
+      if (std::abs(end) < HUGE_VAL)
+	{
+	  for (int k = 1; k <= finiteKnots; ++k)
+	    {
+	      Type next = center + (end - center)*k/finiteKnots;
+	      mass += Integrate(pdf, std::min(from, next),
+				std::max(from, next), tailTolerance);
+	      knots[side].push_back(next);
+	      from = next;
+	    }
+	  continue;
+	}
+
+      Type h = scale;
+      for (int k = 0; k < 1000; ++k)
+	{
+	  Type next = from + sign*h;
+	  Type piece = Integrate(pdf, std::min(from, next),
+				 std::max(from, next), tailTolerance);
+	  mass += piece;
+	  knots[side].push_back(next);
+	  if (!(piece >= tailTolerance))
+	    break;
+	  from = next;
+	  h *= 2;
+	}
+    }
+
+  x.assign(knots[0].rbegin(), knots[0].rend());
+  x.push_back(center);
+  x.insert(x.end(), knots[1].begin(), knots[1].end());
+  return mass;
+}
+
+/* Builds the table.
+ * Input:
+ *   pdf = density, need not be normalized: its mass is estimated
+ *       first, from the pieces between the knots, and the tolerances
+ *       are taken relative to it
+ *   lower, upper = ends of the support, may be -HUGE_VAL & HUGE_VAL
+ *   center = a point in the bulk of the distro, e.g. its mode
+ *   scale = rough width of the bulk, e.g. the standard deviation; the
+ *       knots on an infinite side are center +- scale*(2^k - 1), out
+ *       to where a piece holds less than uTolerance/100 of the mass,
+ *       the support being cut there
+ *   uTolerance = max u-error, defaulted to 1e-10 in header
+ * Returns false, reported on stderr, unless lower <= center <= upper,
+ * scale > 0 where a side is infinite, and the density has positive,
+ * finite mass over the support; the table then gives NaN for every u.
+ */
+bool TabulatedInverseCDF::Build(const Density &pdf, Type lower,
+				Type upper, Type center, Type scale,
+				Type uTolerance)
+{
+  if (!(lower <= center && center <= upper)
+      || (!(scale > 0) && (lower == -HUGE_VAL || upper == HUGE_VAL)))
+    {
+      std::cerr << "TabulatedInverseCDF::Build: need lower <= center "
+		<< "<= upper, and scale > 0 for an infinite support\n";
+      BuildNaN();
+      return false;
+    }
+
+  /* the mass, first relative to the bulk's by a 5-point rule, then
+   * to the mass over the knots so placed */
+  Type halfWidth = scale > 0 ? scale : 0.125*(upper - lower);
+  Type mass = GaussLegendre5(pdf, std::max(lower, center - halfWidth),
+			     std::min(upper, center + halfWidth));
+  if (!(mass > 0 && mass < HUGE_VAL))
+    {
+      mass = 1;
+    }
+  std::vector<Type> x;
+  for (int pass = 0; pass < 2; ++pass)
+    {
+      Type knotMass = PlaceKnots(pdf, lower, upper, center, scale,
+				 0.01*uTolerance*mass, x);
+      if (!(knotMass > 0 && knotMass < HUGE_VAL))
+	break;
+      mass = knotMass;
+    }
+
+  intervals.clear();
+  Type F = 0, f0 = pdf(x[0]);
+  for (size_t i = 0; i + 1 < x.size(); ++i)
+    {
+      Type f1 = pdf(x[i+1]);
+      AddInterval(pdf, x[i], x[i+1], F, f0, f1, uTolerance*mass, 0, F);
+      f0 = f1;
+    }
+
+  if (!(F > 0 && F < HUGE_VAL))
+    {
+      std::cerr << "TabulatedInverseCDF::Build: the density has mass "
+		<< F << " over [" << x.front() << ", " << x.back() << "]\n";
+      BuildNaN();
+      return false;
+    }
+
+  /* normalize the CDF over the (cut) support to [0,1] */
+  for (size_t i = 0; i < intervals.size(); ++i)
+    {
+      intervals[i].u0 /= F;
+      intervals[i].invDu *= F;
+    }
+  intervals.front().u0 = 0;
+  Interval sentinel = {HUGE_VAL, 0, 0, 0, 0, 0};
+  intervals.push_back(sentinel);
+
+  /* cell k of the guide covers [k/G, (k+1)/G) */
+  const unsigned int G = intervals.size() - 1;
+  guide.resize(G + 1);
+  unsigned int i = 0;
+  for (unsigned int k = 0; k <= G; ++k)
+    {
+      while (i + 1 < G && intervals[i+1].u0 <= (Type)k/G)
+	{
+	  ++i;
+	}
+      guide[k] = i;
+    }
+  return true;
+}
+
+/* The table of a failed Build(): one interval giving NaN for every u,
+ * so that the failure shows in the results */
+void TabulatedInverseCDF::BuildNaN()
+{
+  Interval nan = {0, 0, NAN, 0, 0, 0};
+  Interval sentinel = {HUGE_VAL, 0, 0, 0, 0, 0};
+  intervals.assign(1, nan);
+  intervals.push_back(sentinel);
+  guide.assign(2, 0);
+}
@@ -0,0 +1,93 @@
+/* Class TabulatedInverseCDF is a table of the inverse CDF of a
+ * distribution given only by its density (e.g. one of pdflib's
+ * r8_*_pdf), so that any such distribution transforms Unif(0,1) points
+ * in O(1) per number and keeps the structure of QMC points, which a
+ * rejection sampler would not.
+ *
+ * The density is integrated (adaptive Gauss-Legendre) between knots
+ * placed adaptively in x: the support is cut where the tail mass falls
+ * below a fraction of the tolerance, the knots start on a geometric
+ * grid out from the centre, and an interval is halved until the
+ * monotone cubic Hermite interpolant of x(u) on it, with slopes
+ * 1/density limited as in PCHIP (Fritsch-Carlson), is within
+ * uTolerance of u at its quarter points (u-error |F(x(u)) - u|).  Each
+ * interval is one record holding its start in u and the cubic's
+ * coefficients, and a guide table of equal cells of [0,1] gives the
+ * first interval of a cell, so a lookup reads about one record.
+ *
+ * At the default uTolerance of 1e-10 a table of pdflib's gamma, beta
+ * or inverse gamma has 300-1000 intervals (15-50 KB), builds in under
+ * 10 ms, and takes about 4 ns per number, against 100 ns for pdflib's
+ * rejection samplers & 400-4000 ns for Halley's method on the
+ * incomplete gamma & beta functions (TabulatedInverseCDFBenchmark.cpp,
+ * whose reference quantiles they are).  At a
+ * pole at a nonzero end, e.g. x = 1 of Beta(0.5, 0.5), x cannot be
+ * resolved closer than about 1e-13 to the end, and the u-error there
+ * is that of the mass within, 1e-8.
+ */
+
+#ifndef TABULATEDINVERSECDF_H
+#define TABULATEDINVERSECDF_H
+
+#include <cmath>
+#include <vector>
+#include <functional>
+
+typedef double Type;
+
+class TabulatedInverseCDF
+{
+ public:
+  typedef std::function<Type(Type)> Density;
+
+ private:
+  /* x(u) = x0 + t*(c1 + t*(c2 + t*c3)), t = (u - u0)*invDu in [0,1] */
+  struct Interval
+  {
+    Type u0, invDu, x0, c1, c2, c3;
+  };
+
+  std::vector<Interval> intervals;  /* in u order, then a sentinel */
+  std::vector<unsigned int> guide;  /* first interval of each cell */
+
+  void AddInterval(const Density &pdf, Type x0, Type x1, Type F0,
+		   Type f0, Type f1, Type uTolerance, int depth, Type &F1);
+  void BuildNaN();
+
+ public:
+  TabulatedInverseCDF() {}
+  TabulatedInverseCDF(const Density &pdf, Type lower, Type upper,
+		      Type center, Type scale, Type uTolerance = 1e-10)
+    {
+      Build(pdf, lower, upper, center, scale, uTolerance);
+    }
+
+  bool Build(const Density &pdf, Type lower, Type upper, Type center,
+	     Type scale, Type uTolerance = 1e-10);
+
+  /* inverse CDF at u in [0,1] */
+  Type operator()(Type u) const
+  {
+    unsigned int i = guide[(unsigned int)(u*(guide.size() - 1))];
+    while (u >= intervals[i+1].u0)
+      {
+	++i;
+      }
+    const Interval &r = intervals[i];
+    Type t = (u - r.u0)*r.invDu;
+    return r.x0 + t*(r.c1 + t*(r.c2 + t*r.c3));
+  }
+
+  /* x[i] = inverse CDF at u[i] for i < n, as an InverseCDF; x may be
+   * u */
+  void operator()(const Type *u, unsigned int n, Type *x) const
+  {
+    for (unsigned int i = 0; i < n; ++i)
+      {
+	x[i] = (*this)(u[i]);
+      }
+  }
+
+  unsigned int GetNumIntervals() const {return intervals.size() - 1;}
+};
+#endif
@@ -0,0 +1,387 @@
+/* Accuracy & throughput of class TabulatedInverseCDF on pdflib's gamma,
+ * beta & inverse gamma densities.  The tables are checked against the
+ * reference quantiles below (Halley on the incomplete gamma & beta
+ * functions, to about 1e-14), over u = (k + 1/2)/n & log-uniform
+ * tails down to 1e-12.  The u-error is |x - x(u)| times the density
+ * half way (left out where x(u) rounds onto a pole), the x-error is
+ * relative to x(u) & taken over the evenly spaced u, the support of a
+ * table being cut in the far tails.  The times are per number of a
+ * block in cache: the table, the Halley quantiles & pdflib's rejection
+ * samplers r8_*_sample, which are what the tables replace.
+ * Usage: ./a.out [points] [repeats] [u-tolerance]
+ */
+
+#include "TabulatedInverseCDF.h"
+#include "InverseTransformation.h"
+#include "pdflib.h"
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iomanip>
+
+/* Regularized incomplete gamma functions P(a,x) & Q(a,x) = 1 - P(a,x),
+ * by the series for x < a+1 & the continued fraction (modified Lentz)
+ * otherwise, whichever of P or Q it gives being the accurate one
+ * (Numerical Recipes, 6.2).  lnGammaA = log(Gamma(a)).
+ */
+static void IncompleteGamma(Type a, Type x, Type lnGammaA, Type &P,
+			    Type &Q)
+{
+  const Type eps = 1e-16, tiny = 1e-300;
+  if (x <= 0)
+    {
+      P = 0;
+      Q = 1;
+      return;
+    }
+  Type front = exp(-x + a*log(x) - lnGammaA);
+
+  if (x < a + 1)
+    {
+      Type ap = a, del = 1.0/a, sum = del;
+      for (int n = 0; n < 100000 && std::abs(del) >= std::abs(sum)*eps;
+	   ++n)
+	{
+	  ap += 1;
+	  del *= x/ap;
+	  sum += del;
+	}
+      P = sum*front;
+      Q = 1 - P;
+    }
+  else
+    {
+      Type b = x + 1 - a, c = 1/tiny, d = 1/b, h = d;
+      for (int i = 1; i < 100000; ++i)
+	{
+	  Type an = -i*(i - a);
+	  b += 2;
+	  d = an*d + b;
+	  if (std::abs(d) < tiny)
+	    d = tiny;
+	  c = b + an/c;
+	  if (std::abs(c) < tiny)
+	    c = tiny;
+	  d = 1/d;
+	  Type del = d*c;
+	  h *= del;
+	  if (std::abs(del - 1) <= eps)
+	    break;
+	}
+      Q = front*h;
+      P = 1 - Q;
+    }
+}
+
+/* Quantile of the gamma distro of the given shape & scale at u: the
+ * root of P(shape, x) = u by
+ * Halley's method from Wichura's & Wilson-Hilferty's starting values
+ * (Numerical Recipes, 6.2.1), matching Q = 1-u in the upper half so
+ * that u near 1 keeps its digits.  Some microseconds per number.
+ */
+static Type GammaQuantile(Type u, Type shape, Type scale)
+{
+  const Type a = shape, a1 = a - 1;
+  const Type lnGammaA = std::lgamma(a);
+  if (u <= 0)
+    return 0;
+  if (u >= 1)
+    return HUGE_VAL;
+
+  Type x, t, lna1 = 0, afac = 0;
+  if (a > 1)
+    {
+      lna1 = log(a1);
+      afac = exp(a1*(lna1 - 1) - lnGammaA);
+      Type z = InverseTransformation::StandardNormal(INVERSE_NORMAL_AS241,
+						     u);
+      /* P(a,x) <= x^a/Gamma(a+1), so the root is at least xs, the
+       * better start far in the lower tail */
+      Type xs = exp((log(u) + log(a) + lnGammaA)/a);
+      x = std::max(xs, a*pow(1 - 1/(9*a) + z/(3*sqrt(a)), 3));
+    }
+  else
+    {
+      t = 1 - a*(0.253 + a*0.12);
+      if (u < t)
+	x = pow(u/t, 1/a);
+      else
+	x = 1 - log(1 - (u - t)/(1 - t));
+    }
+
+  for (int j = 0; j < 100; ++j)
+    {
+      if (x <= 0)
+	return 0;
+      Type P, Q;
+      IncompleteGamma(a, x, lnGammaA, P, Q);
+      Type err = u < 0.5 ? P - u : (1 - u) - Q;
+      /* density at x */
+      if (a > 1)
+	t = afac*exp(-(x - a1) + a1*(log(x) - lna1));
+      else
+	t = exp(-x + a1*log(x) - lnGammaA);
+      Type step = err/t;
+      step = step/(1 - 0.5*std::min(1.0, step*(a1/x - 1)));
+      x -= step;
+      if (x <= 0)
+	x = 0.5*(x + step);
+      if (std::abs(step) <= 1e-15*x)
+	break;
+    }
+  return scale*x;
+}
+
+/* Continued fraction of I_x(a,b) by the modified Lentz method, fast
+ * for x < (a+1)/(a+b+2) (Numerical Recipes, 6.4) */
+static Type BetaFraction(Type a, Type b, Type x)
+{
+  const Type eps = 1e-16, tiny = 1e-300;
+  Type qab = a + b, qap = a + 1, qam = a - 1;
+  Type c = 1, d = 1 - qab*x/qap;
+  if (std::abs(d) < tiny)
+    d = tiny;
+  d = 1/d;
+  Type h = d;
+  for (int m = 1; m < 100000; ++m)
+    {
+      int m2 = 2*m;
+      Type aa = m*(b - m)*x/((qam + m2)*(a + m2));
+      d = 1 + aa*d;
+      if (std::abs(d) < tiny)
+	d = tiny;
+      c = 1 + aa/c;
+      if (std::abs(c) < tiny)
+	c = tiny;
+      d = 1/d;
+      h *= d*c;
+      aa = -(a + m)*(qab + m)*x/((a + m2)*(qap + m2));
+      d = 1 + aa*d;
+      if (std::abs(d) < tiny)
+	d = tiny;
+      c = 1 + aa/c;
+      if (std::abs(c) < tiny)
+	c = tiny;
+      d = 1/d;
+      Type del = d*c;
+      h *= del;
+      if (std::abs(del - 1) <= eps)
+	break;
+    }
+  return h;
+}
+
+/* Regularized incomplete beta function I = I_x(a,b) & J = 1 - I, by
+ * the continued fraction on whichever side of the mean it converges
+ * fast.  lnBeta = log B(a,b).
+ */
+static void IncompleteBeta(Type a, Type b, Type x, Type lnBeta, Type &I,
+			   Type &J)
+{
+  if (x <= 0 || x >= 1)
+    {
+      I = x <= 0 ? 0 : 1;
+      J = 1 - I;
+      return;
+    }
+  Type front = exp(a*log(x) + b*log(1 - x) - lnBeta);
+  if (x < (a + 1)/(a + b + 2))
+    {
+      I = front*BetaFraction(a, b, x)/a;
+      J = 1 - I;
+    }
+  else
+    {
+      J = front*BetaFraction(b, a, 1 - x)/b;
+      I = 1 - J;
+    }
+}
+
+/* Quantile of the beta distro with shapes alpha & beta on [0,1] at u:
+ * the root of I_x(alpha, beta) = u
+ * by Halley's method (Numerical Recipes, 6.4.1), matching
+ * 1 - I = 1-u in the upper half.  Some microseconds per number.
+ */
+static Type BetaQuantile(Type u, Type alpha, Type beta)
+{
+  const Type a = alpha, b = beta, a1 = a - 1, b1 = b - 1;
+  const Type lnBeta = std::lgamma(a) + std::lgamma(b) - std::lgamma(a + b);
+  if (u <= 0)
+    return 0;
+  if (u >= 1)
+    return 1;
+
+  Type x;
+  if (a >= 1 && b >= 1)
+    {
+      Type z = -InverseTransformation::StandardNormal(INVERSE_NORMAL_AS241,
+						      u);
+      Type al = (z*z - 3)/6;
+      Type h = 2/(1/(2*a - 1) + 1/(2*b - 1));
+      Type w = z*sqrt(al + h)/h
+	- (1/(2*b - 1) - 1/(2*a - 1))*(al + 5.0/6 - 2/(3*h));
+      x = a/(a + b*exp(2*w));
+    }
+  else
+    {
+      Type lna = log(a/(a + b)), lnb = log(b/(a + b));
+      Type t = exp(a*lna)/a, s = exp(b*lnb)/b, w = t + s;
+      if (u < t/w)
+	x = pow(a*w*u, 1/a);
+      else
+	x = 1 - pow(b*w*(1 - u), 1/b);
+    }
+
+  for (int j = 0; j < 100; ++j)
+    {
+      if (x <= 0 || x >= 1)
+	return x <= 0 ? 0 : 1;
+      Type I, J;
+      IncompleteBeta(a, b, x, lnBeta, I, J);
+      Type err = u < 0.5 ? I - u : (1 - u) - J;
+      Type t = exp(a1*log(x) + b1*log(1 - x) - lnBeta);  /* density */
+      Type step = err/t;
+      step = step/(1 - 0.5*std::min(1.0, step*(a1/x - b1/(1 - x))));
+      x -= step;
+      if (x <= 0)
+	x = 0.5*(x + step);
+      if (x >= 1)
+	x = 0.5*(x + step + 1);
+      if (std::abs(step) <= 1e-15*std::min(x, 1 - x))
+	break;
+    }
+  return x;
+}
+
+struct Case
+{
+  const char *name;
+  TabulatedInverseCDF::Density pdf;
+  Type lower, upper, center, scale;
+  std::function<Type(Type)> quantile;  /* exact inverse CDF */
+  std::function<Type()> sample;  /* pdflib's rejection sampler */
+};
+
+int main(int argc, char** argv)
+{
+  unsigned int n = argc > 1 ? atoi(argv[1]) : 100000;
+  int repeats = argc > 2 ? atoi(argv[2]) : 2000;
+  Type uTolerance = argc > 3 ? atof(argv[3]) : 1e-10;
+
+  /* pdflib's gamma takes (rate, shape), the inverse gamma (scale,
+   * shape) */
+  std::vector<Case> cases = {
+    {"gamma(0.5, 1)",
+     [](Type x) {return r8_gamma_pdf(1, 0.5, x);}, 0, HUGE_VAL, 0.5,
+     sqrt(0.5),
+     [](Type u) {return GammaQuantile(u, 0.5, 1);},
+     []() {return r8_gamma_sample(1, 0.5);}},
+    {"gamma(3, 2)",
+     [](Type x) {return r8_gamma_pdf(0.5, 3, x);}, 0, HUGE_VAL, 6,
+     2*sqrt(3.0),
+     [](Type u) {return GammaQuantile(u, 3, 2);},
+     []() {return r8_gamma_sample(0.5, 3);}},
+    {"beta(0.5, 0.5)",
+     [](Type x) {return r8_beta_pdf(0.5, 0.5, x);}, 0, 1, 0.5,
+     sqrt(0.125),
+     [](Type u) {return BetaQuantile(u, 0.5, 0.5);},
+     []() {return r8_beta_sample(0.5, 0.5);}},
+    {"beta(2, 5)",
+     [](Type x) {return r8_beta_pdf(2, 5, x);}, 0, 1, 2.0/7,
+     sqrt(10/8.0)/7,
+     [](Type u) {return BetaQuantile(u, 2, 5);},
+     []() {return r8_beta_sample(2, 5);}},
+    {"invgamma(3, 2)",
+     [](Type x) {return r8_invgam_pdf(2, 3, x);}, 0, HUGE_VAL, 0.5, 0.5,
+     [](Type u) {return 2/GammaQuantile(1 - u, 3, 1);},
+     []() {return r8_invgam_sample(2, 3);}}
+  };
+
+  /* the accuracy points, then a block of uniforms in cache, as the
+   * samplers hand them over */
+  std::vector<Type> points;
+  for (unsigned int k = 0; k < n; ++k)
+    {
+      points.push_back((k + 0.5)/n);
+      Type p = pow(10.0, -12 + (log10(0.5/n) + 12)*(k + 0.5)/n);
+      points.push_back(k % 2 ? 1 - p : p);
+    }
+  const unsigned int B = 512;
+  std::vector<Type> u(B), x(B);
+  for (unsigned int k = 0; k < B; ++k)
+    {
+      u[k] = (k*0.6180339887498949 - (int)(k*0.6180339887498949))
+	+ 0.5/B;
+      if (u[k] >= 1)
+	u[k] -= 1;
+    }
+
+  std::cout << "u-tolerance " << uTolerance << ", " << 2*n
+	    << " points, blocks of " << B << "\n\n";
+  std::cout << "distro          intervals  build(s)  max u-err  "
+	    << "max rel x-err  ns/number: table   Halley  rejection\n";
+  for (size_t c = 0; c < cases.size(); ++c)
+    {
+      const Case &cs = cases[c];
+      clock_t tic = clock();
+      TabulatedInverseCDF table(cs.pdf, cs.lower, cs.upper, cs.center,
+				cs.scale, uTolerance);
+      Type build = (Type)(clock() - tic) / CLOCKS_PER_SEC;
+
+      Type uError = 0, xError = 0;
+      for (size_t k = 0; k < points.size(); ++k)
+	{
+	  Type ref = cs.quantile(points[k]), xt = table(points[k]);
+	  Type e = std::abs(xt - ref), f = cs.pdf(0.5*(xt + ref));
+	  if (e > 0 && f < HUGE_VAL)
+	    uError = std::max(uError, e*f);
+	  if (k % 2 == 0)
+	    xError = std::max(xError, e/ref);
+	}
+
+      Type sum = 0;
+      tic = clock();
+      for (int r = 0; r < repeats; ++r)
+	{
+	  table(u.data(), B, x.data());
+	  sum += x[r % B];
+	}
+      Type tabulated = (Type)(clock() - tic) / CLOCKS_PER_SEC;
+
+      /* the Halley quantiles & the samplers are far slower, so fewer
+       * repeats */
+      int slowRepeats = std::max(repeats/100, 1);
+      tic = clock();
+      for (int r = 0; r < slowRepeats; ++r)
+	{
+	  for (unsigned int k = 0; k < B; ++k)
+	    {
+	      x[k] = cs.quantile(u[k]);
+	    }
+	  sum += x[r % B];
+	}
+      Type halley = (Type)(clock() - tic) / CLOCKS_PER_SEC;
+
+      tic = clock();
+      for (int r = 0; r < slowRepeats; ++r)
+	{
+	  for (unsigned int k = 0; k < B; ++k)
+	    {
+	      x[k] = cs.sample();
+	    }
+	  sum += x[r % B];
+	}
+      Type rejection = (Type)(clock() - tic) / CLOCKS_PER_SEC;
+
+      std::cout << std::setw(16) << std::left << cs.name << std::right
+		<< std::setw(9) << table.GetNumIntervals()
+		<< std::fixed << std::setprecision(3) << std::setw(10) << build
+		<< std::scientific << std::setprecision(2)
+		<< std::setw(11) << uError << std::setw(15) << xError
+		<< std::fixed << std::setprecision(1)
+		<< std::setw(18) << 1e9*tabulated/((Type)B*repeats)
+		<< std::setw(9) << 1e9*halley/((Type)B*slowRepeats)
+		<< std::setw(11) << 1e9*rejection/((Type)B*slowRepeats)
+		<< (sum == 12345 ? " " : "") << "\n";
+    }
+}
@@ -0,0 +1,6 @@
+#!/bin/bash
+
+g++ -O3 -std=c++0x TabulatedInverseCDFBenchmark.cpp TabulatedInverseCDF.cpp InverseTransformation.cpp MersenneTwister.cpp pdflib.cpp rnglib.cpp
+
+# ./a.out 100000 2000
+# ./a.out 100000 2000 1e-12